@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <bitset>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+
+using namespace std;
+
+namespace {
+    template <size_t N, class charT>
+    auto random_digits_init() {
+        mt19937_64 rnd{};
+        uniform_int_distribution<> dist(0, 1);
+        array<basic_string<charT>, 32> arr;
+        for (auto& str : arr) {
+            str.resize(N);
+            for (auto& ch : str) {
+                ch = static_cast<charT>('0' + dist(rnd));
+            }
+        }
+        return arr;
+    }
+
+    template <size_t N, class charT>
+    const auto random_digits = random_digits_init<N, charT>();
+
+    template <size_t N, class charT>
+    void BM_bitset_from_string(benchmark::State& state) {
+        for (auto _ : state) {
+            for (const auto& str : random_digits<N, charT>) {
+                benchmark::DoNotOptimize(str);
+                bitset<N> bs{str};
+                benchmark::DoNotOptimize(bs);
+            }
+        }
+    }
+
+    template <size_t N, class charT>
+    void BM_bitset_from_c_string(benchmark::State& state) {
+        for (auto _ : state) {
+            for (const auto& str : random_digits<N, charT>) {
+                benchmark::DoNotOptimize(str);
+                bitset<N> bs{str.c_str()};
+                benchmark::DoNotOptimize(bs);
+            }
+        }
+    }
+} // namespace
+
+BENCHMARK(BM_bitset_from_string<15, char>);
+BENCHMARK(BM_bitset_from_string<64, char>);
+BENCHMARK(BM_bitset_from_string<512, char>);
+BENCHMARK(BM_bitset_from_string<4096, char>);
+BENCHMARK(BM_bitset_from_c_string<64, char>);
+BENCHMARK(BM_bitset_from_c_string<4096, char>);
+BENCHMARK(BM_bitset_from_string<7, wchar_t>);
+BENCHMARK(BM_bitset_from_string<64, wchar_t>);
+BENCHMARK(BM_bitset_from_string<512, wchar_t>);
+BENCHMARK(BM_bitset_from_string<4096, wchar_t>);
+
+BENCHMARK_MAIN();
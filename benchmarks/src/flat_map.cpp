@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <flat_map>
+#include <flat_set>
+#include <map>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <utility.hpp>
+
+using namespace std;
+
+namespace {
+    template <class Cont>
+    constexpr bool is_mappish = requires { typename Cont::mapped_type; };
+
+    template <class Cont>
+    auto make_elements(const size_t size) {
+        const auto keys = random_vector<uint32_t>(size);
+        if constexpr (is_mappish<Cont>) {
+            vector<pair<uint32_t, uint32_t>> result;
+            result.reserve(size);
+            for (const auto key : keys) {
+                result.emplace_back(key, key);
+            }
+
+            return result;
+        } else {
+            return keys;
+        }
+    }
+
+    template <class Cont>
+    void bm_build_bulk(benchmark::State& state) {
+        const auto elements = make_elements<Cont>(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            Cont c(elements.begin(), elements.end());
+            benchmark::DoNotOptimize(c);
+        }
+    }
+
+    template <class Cont>
+    void bm_build_one_by_one(benchmark::State& state) {
+        const auto elements = make_elements<Cont>(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            Cont c;
+            for (const auto& elem : elements) {
+                c.insert(elem);
+            }
+
+            benchmark::DoNotOptimize(c);
+        }
+    }
+
+    template <class Cont>
+    void bm_lookup(benchmark::State& state) {
+        const auto elements = make_elements<Cont>(static_cast<size_t>(state.range(0)));
+        const Cont c(elements.begin(), elements.end());
+        for (auto _ : state) {
+            for (const auto& elem : elements) {
+                if constexpr (is_mappish<Cont>) {
+                    benchmark::DoNotOptimize(c.find(elem.first));
+                } else {
+                    benchmark::DoNotOptimize(c.find(elem));
+                }
+            }
+        }
+    }
+
+    template <class Cont>
+    void bm_iterate(benchmark::State& state) {
+        const auto elements = make_elements<Cont>(static_cast<size_t>(state.range(0)));
+        const Cont c(elements.begin(), elements.end());
+        for (auto _ : state) {
+            uint32_t sum = 0;
+            for (const auto& elem : c) {
+                if constexpr (is_mappish<Cont>) {
+                    sum += elem.second;
+                } else {
+                    sum += elem;
+                }
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+} // namespace
+
+#define BENCHMARK_ALL(bm)                                                                 \
+    BENCHMARK(bm<map<uint32_t, uint32_t>>)->RangeMultiplier(16)->Range(16, 1 << 20);      \
+    BENCHMARK(bm<flat_map<uint32_t, uint32_t>>)->RangeMultiplier(16)->Range(16, 1 << 20); \
+    BENCHMARK(bm<set<uint32_t>>)->RangeMultiplier(16)->Range(16, 1 << 20);                \
+    BENCHMARK(bm<flat_set<uint32_t>>)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+BENCHMARK_ALL(bm_build_bulk);
+BENCHMARK_ALL(bm_lookup);
+BENCHMARK_ALL(bm_iterate);
+
+BENCHMARK(bm_build_one_by_one<map<uint32_t, uint32_t>>)->RangeMultiplier(4)->Range(16, 1 << 14);
+BENCHMARK(bm_build_one_by_one<flat_map<uint32_t, uint32_t>>)->RangeMultiplier(4)->Range(16, 1 << 14);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,227 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <flat_hash_map>
+#include <functional>
+#include <memory>
+#include <node_hash_map>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <utility.hpp>
+
+using namespace std;
+using stdext::flat_hash_map;
+using stdext::node_hash_map;
+
+namespace {
+    size_t allocated_bytes = 0;
+
+    template <class T>
+    struct counting_allocator {
+        using value_type = T;
+
+        counting_allocator() = default;
+        template <class U>
+        counting_allocator(const counting_allocator<U>&) {}
+
+        T* allocate(const size_t n) {
+            allocated_bytes += n * sizeof(T);
+            return allocator<T>{}.allocate(n);
+        }
+
+        void deallocate(T* const p, const size_t n) {
+            allocated_bytes -= n * sizeof(T);
+            allocator<T>{}.deallocate(p, n);
+        }
+
+        template <class U>
+        bool operator==(const counting_allocator<U>&) const noexcept {
+            return true;
+        }
+
+        template <class U>
+        bool operator!=(const counting_allocator<U>&) const noexcept {
+            return false;
+        }
+    };
+
+    template <class Map, class = void>
+    constexpr bool has_buckets = false;
+
+    template <class Map>
+    constexpr bool has_buckets<Map, void_t<decltype(declval<const Map&>().bucket_count())>> = true;
+
+    template <class Key>
+    vector<Key> make_keys(const size_t size) {
+        const auto raw = random_vector<uint64_t>(size);
+        if constexpr (is_same_v<Key, string>) {
+            vector<string> result;
+            result.reserve(size);
+            for (const auto val : raw) {
+                result.push_back("key_" + to_string(val));
+            }
+
+            return result;
+        } else {
+            return vector<Key>(raw.begin(), raw.end());
+        }
+    }
+
+    template <class Map>
+    Map make_map(const vector<typename Map::key_type>& keys) {
+        Map m;
+        for (const auto& key : keys) {
+            m.emplace(key, 0);
+        }
+
+        return m;
+    }
+
+    template <class Map>
+    void bm_insert(benchmark::State& state) {
+        const auto keys = make_keys<typename Map::key_type>(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            Map m;
+            for (const auto& key : keys) {
+                m.emplace(key, 0);
+            }
+
+            benchmark::DoNotOptimize(m);
+        }
+    }
+
+    template <class Map>
+    void bm_find_hit(benchmark::State& state) {
+        const auto keys = make_keys<typename Map::key_type>(static_cast<size_t>(state.range(0)));
+        const auto m    = make_map<Map>(keys);
+        for (auto _ : state) {
+            for (const auto& key : keys) {
+                benchmark::DoNotOptimize(m.find(key));
+            }
+        }
+    }
+
+    template <class Map>
+    void bm_find_miss(benchmark::State& state) {
+        const auto size   = static_cast<size_t>(state.range(0));
+        const auto m      = make_map<Map>(make_keys<typename Map::key_type>(size));
+        const auto probes = make_keys<typename Map::key_type>(size);
+        for (auto _ : state) {
+            for (const auto& key : probes) {
+                benchmark::DoNotOptimize(m.find(key));
+            }
+        }
+    }
+
+    template <class Map>
+    void bm_erase(benchmark::State& state) {
+        const auto keys     = make_keys<typename Map::key_type>(static_cast<size_t>(state.range(0)));
+        const auto original = make_map<Map>(keys);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto m = original;
+            state.ResumeTiming();
+            for (const auto& key : keys) {
+                m.erase(key);
+            }
+
+            benchmark::DoNotOptimize(m);
+        }
+    }
+
+    template <class Map>
+    void bm_iterate(benchmark::State& state) {
+        const auto m = make_map<Map>(make_keys<typename Map::key_type>(static_cast<size_t>(state.range(0))));
+        for (auto _ : state) {
+            size_t sum = 0;
+            for (const auto& elem : m) {
+                sum += static_cast<size_t>(elem.second) + 1;
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+
+    template <class Map>
+    void bm_memory(benchmark::State& state) {
+        // reports the bytes the table allocates per element, and for chained tables the buckets per element
+        const auto keys   = make_keys<typename Map::key_type>(static_cast<size_t>(state.range(0)));
+        size_t total      = 0;
+        size_t bucket_cnt = 0;
+        for (auto _ : state) {
+            const size_t before = allocated_bytes;
+            const auto m        = make_map<Map>(keys);
+            total               = allocated_bytes - before;
+            if constexpr (has_buckets<Map>) {
+                bucket_cnt = m.bucket_count();
+            }
+
+            benchmark::DoNotOptimize(m);
+        }
+
+        const auto size                     = static_cast<double>(keys.size());
+        state.counters["bytes_per_element"] = static_cast<double>(total) / size;
+        if (bucket_cnt != 0) {
+            state.counters["buckets_per_element"] = static_cast<double>(bucket_cnt) / size;
+        }
+    }
+
+    template <class Map>
+    void bm_rehash(benchmark::State& state) {
+        const auto original = make_map<Map>(make_keys<typename Map::key_type>(static_cast<size_t>(state.range(0))));
+        const size_t target = original.bucket_count() * 4;
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto m = original;
+            state.ResumeTiming();
+            m.rehash(target);
+            benchmark::DoNotOptimize(m);
+        }
+    }
+
+    template <class Key>
+    using counted_alloc = counting_allocator<pair<const Key, int>>;
+
+    template <class Key>
+    using two_pointer_map = unordered_map<Key, int, hash<Key>, equal_to<Key>, counted_alloc<Key>>;
+
+    template <class Key>
+    using one_pointer_map = node_hash_map<Key, int, hash<Key>, equal_to<Key>, counted_alloc<Key>>;
+
+    template <class Key>
+    using open_map = flat_hash_map<Key, int, hash<Key>, equal_to<Key>, counted_alloc<Key>>;
+} // namespace
+
+#define BENCHMARK_CHAINED(bm, key)                                                \
+    BENCHMARK(bm<two_pointer_map<key>>)->RangeMultiplier(16)->Range(16, 1 << 20); \
+    BENCHMARK(bm<one_pointer_map<key>>)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+#define BENCHMARK_ALL(bm, key) \
+    BENCHMARK_CHAINED(bm, key) \
+    BENCHMARK(bm<open_map<key>>)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+BENCHMARK_ALL(bm_insert, uint64_t);
+BENCHMARK_ALL(bm_insert, string);
+BENCHMARK_ALL(bm_find_hit, uint64_t);
+BENCHMARK_ALL(bm_find_hit, string);
+BENCHMARK_ALL(bm_find_miss, uint64_t);
+BENCHMARK_ALL(bm_find_miss, string);
+BENCHMARK_ALL(bm_erase, uint64_t);
+BENCHMARK_ALL(bm_erase, string);
+BENCHMARK_ALL(bm_iterate, uint64_t);
+BENCHMARK_ALL(bm_iterate, string);
+BENCHMARK_ALL(bm_memory, uint64_t);
+BENCHMARK_ALL(bm_memory, string);
+
+// only the chained tables have buckets to grow
+BENCHMARK_CHAINED(bm_rehash, uint64_t);
+BENCHMARK_CHAINED(bm_rehash, string);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <utility.hpp>
+
+using namespace std;
+
+namespace {
+    enum class input_order { sorted, shuffled };
+
+    vector<pair<uint32_t, uint32_t>> make_elements(const size_t size, const input_order order) {
+        auto keys = random_vector<uint32_t>(size);
+        if (order == input_order::sorted) {
+            sort(keys.begin(), keys.end());
+        }
+
+        vector<pair<uint32_t, uint32_t>> result;
+        result.reserve(size);
+        for (const auto key : keys) {
+            result.emplace_back(key, key);
+        }
+
+        return result;
+    }
+
+    template <class Cont, input_order Order>
+    void bm_construct(benchmark::State& state) {
+        const auto elements = make_elements(static_cast<size_t>(state.range(0)), Order);
+        for (auto _ : state) {
+            Cont c(elements.begin(), elements.end());
+            benchmark::DoNotOptimize(c);
+        }
+    }
+
+    template <class Cont, input_order Order>
+    void bm_insert_into_existing(benchmark::State& state) {
+        const auto existing = make_elements(static_cast<size_t>(state.range(0)), input_order::sorted);
+        const auto elements = make_elements(static_cast<size_t>(state.range(0)), Order);
+        for (auto _ : state) {
+            state.PauseTiming();
+            Cont c(existing.begin(), existing.end());
+            state.ResumeTiming();
+            c.insert(elements.begin(), elements.end());
+            benchmark::DoNotOptimize(c);
+        }
+    }
+
+    template <class Cont>
+    void bm_merge(benchmark::State& state) {
+        const auto existing = make_elements(static_cast<size_t>(state.range(0)), input_order::sorted);
+        const auto elements = make_elements(static_cast<size_t>(state.range(0)), input_order::sorted);
+        for (auto _ : state) {
+            state.PauseTiming();
+            Cont target(existing.begin(), existing.end());
+            Cont source(elements.begin(), elements.end());
+            state.ResumeTiming();
+            target.merge(source);
+            benchmark::DoNotOptimize(target);
+        }
+    }
+} // namespace
+
+BENCHMARK(bm_construct<map<uint32_t, uint32_t>, input_order::sorted>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(bm_construct<map<uint32_t, uint32_t>, input_order::shuffled>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(bm_construct<multimap<uint32_t, uint32_t>, input_order::sorted>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(bm_construct<multimap<uint32_t, uint32_t>, input_order::shuffled>)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+BENCHMARK(bm_insert_into_existing<map<uint32_t, uint32_t>, input_order::sorted>)
+    ->RangeMultiplier(16)
+    ->Range(16, 1 << 20);
+BENCHMARK(bm_insert_into_existing<map<uint32_t, uint32_t>, input_order::shuffled>)
+    ->RangeMultiplier(16)
+    ->Range(16, 1 << 20);
+
+BENCHMARK(bm_merge<map<uint32_t, uint32_t>>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(bm_merge<multimap<uint32_t, uint32_t>>)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <node_cache>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+using namespace std;
+using stdext::node_cache;
+using stdext::node_cache_allocator;
+
+namespace {
+    template <class Cont>
+    constexpr bool uses_node_cache =
+        is_same_v<typename Cont::allocator_type, node_cache_allocator<typename Cont::value_type>>;
+
+    template <class Cont>
+    void fill(Cont& c, const uint32_t size) {
+        for (uint32_t i = 0; i < size; ++i) {
+            if constexpr (is_same_v<typename Cont::value_type, uint32_t>) {
+                c.push_back(i);
+            } else {
+                c.emplace(i, i);
+            }
+        }
+    }
+
+    // a short-lived container per iteration, as when building a lookup table for each request
+    template <class Cont>
+    void bm_build_destroy(benchmark::State& state) {
+        const auto size = static_cast<uint32_t>(state.range(0));
+        node_cache cache{static_cast<size_t>(size)};
+        for (auto _ : state) {
+            if constexpr (uses_node_cache<Cont>) {
+                Cont c(&cache);
+                fill(c, size);
+                benchmark::DoNotOptimize(c);
+            } else {
+                Cont c;
+                fill(c, size);
+                benchmark::DoNotOptimize(c);
+            }
+        }
+    }
+
+    // one long-lived container that is cleared and refilled
+    template <class Cont>
+    void bm_build_clear(benchmark::State& state) {
+        const auto size = static_cast<uint32_t>(state.range(0));
+        node_cache cache{static_cast<size_t>(size)};
+        Cont c = [&] {
+            if constexpr (uses_node_cache<Cont>) {
+                return Cont(&cache);
+            } else {
+                return Cont();
+            }
+        }();
+
+        for (auto _ : state) {
+            fill(c, size);
+            benchmark::DoNotOptimize(c);
+            c.clear();
+        }
+    }
+
+    using std_map     = map<uint32_t, uint32_t>;
+    using cached_map  = map<uint32_t, uint32_t, less<uint32_t>, node_cache_allocator<pair<const uint32_t, uint32_t>>>;
+    using std_list    = list<uint32_t>;
+    using cached_list = list<uint32_t, node_cache_allocator<uint32_t>>;
+    using std_umap    = unordered_map<uint32_t, uint32_t>;
+    using cached_umap = unordered_map<uint32_t, uint32_t, hash<uint32_t>, equal_to<uint32_t>,
+        node_cache_allocator<pair<const uint32_t, uint32_t>>>;
+} // namespace
+
+#define BENCHMARK_ALL(bm)                                                \
+    BENCHMARK(bm<std_map>)->RangeMultiplier(16)->Range(16, 1 << 16);     \
+    BENCHMARK(bm<cached_map>)->RangeMultiplier(16)->Range(16, 1 << 16);  \
+    BENCHMARK(bm<std_list>)->RangeMultiplier(16)->Range(16, 1 << 16);    \
+    BENCHMARK(bm<cached_list>)->RangeMultiplier(16)->Range(16, 1 << 16); \
+    BENCHMARK(bm<std_umap>)->RangeMultiplier(16)->Range(16, 1 << 16);    \
+    BENCHMARK(bm<cached_umap>)->RangeMultiplier(16)->Range(16, 1 << 16);
+
+BENCHMARK_ALL(bm_build_destroy);
+BENCHMARK_ALL(bm_build_clear);
+
+BENCHMARK_MAIN();
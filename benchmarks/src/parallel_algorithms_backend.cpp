@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Compares the backends of the parallel algorithms; run once as is (Windows thread pool), then again with the
+// environment variable STL_PARALLEL_ALGORITHMS_BACKEND=threads (std::thread workers), optionally setting
+// STL_PARALLEL_ALGORITHMS_THREADS and STL_PARALLEL_ALGORITHMS_AFFINITY.
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+#include <utility.hpp>
+
+using namespace std;
+
+namespace {
+    template <class ExPo>
+    void bm_sort(benchmark::State& state) {
+        const auto src = random_vector<uint32_t>(static_cast<size_t>(state.range(0)));
+        vector<uint32_t> v(src.size());
+        for (auto _ : state) {
+            state.PauseTiming();
+            copy(src.begin(), src.end(), v.begin());
+            state.ResumeTiming();
+            sort(ExPo{}, v.begin(), v.end());
+            benchmark::DoNotOptimize(v.data());
+        }
+    }
+
+    template <class ExPo>
+    void bm_reduce(benchmark::State& state) {
+        const auto src = random_vector<uint64_t>(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(src.data());
+            benchmark::DoNotOptimize(reduce(ExPo{}, src.begin(), src.end(), uint64_t{0}));
+        }
+    }
+
+    template <class ExPo>
+    void bm_for_each(benchmark::State& state) {
+        vector<double> v(static_cast<size_t>(state.range(0)), 2.0);
+        for (auto _ : state) {
+            for_each(ExPo{}, v.begin(), v.end(), [](double& d) { d = sqrt(d + 1.0); });
+            benchmark::DoNotOptimize(v.data());
+        }
+    }
+} // namespace
+
+BENCHMARK(bm_sort<execution::sequenced_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(bm_sort<execution::parallel_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(bm_reduce<execution::sequenced_policy>)->Range(1 << 10, 1 << 24);
+BENCHMARK(bm_reduce<execution::parallel_policy>)->Range(1 << 10, 1 << 24);
+BENCHMARK(bm_for_each<execution::sequenced_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(bm_for_each<execution::parallel_policy>)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+#include <utility.hpp>
+
+using namespace std;
+
+namespace {
+    template <class ExPo>
+    void transform_unary(benchmark::State& state) {
+        const auto src = random_vector<float>(static_cast<size_t>(state.range(0)));
+        vector<float> dst(src.size());
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(src.data());
+            transform(ExPo{}, src.begin(), src.end(), dst.begin(), [](float x) { return x * 0.5f + 1.0f; });
+            benchmark::DoNotOptimize(dst.data());
+        }
+    }
+
+    template <class ExPo>
+    void transform_binary(benchmark::State& state) {
+        const auto src1 = random_vector<float>(static_cast<size_t>(state.range(0)));
+        const auto src2 = random_vector<float>(src1.size());
+        vector<float> dst(src1.size());
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(src1.data());
+            benchmark::DoNotOptimize(src2.data());
+            transform(
+                ExPo{}, src1.begin(), src1.end(), src2.begin(), dst.begin(), [](float x, float y) { return x * y; });
+            benchmark::DoNotOptimize(dst.data());
+        }
+    }
+
+    template <class ExPo>
+    void reduce_max(benchmark::State& state) {
+        // not plus<>, so the serial reduce can't vectorize it
+        const auto src = random_vector<uint32_t>(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(src.data());
+            benchmark::DoNotOptimize(reduce(
+                ExPo{}, src.begin(), src.end(), uint32_t{0}, [](uint32_t x, uint32_t y) { return x < y ? y : x; }));
+        }
+    }
+
+    template <class ExPo>
+    void transform_reduce_unary(benchmark::State& state) {
+        const auto src = random_vector<uint32_t>(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(src.data());
+            benchmark::DoNotOptimize(transform_reduce(
+                ExPo{}, src.begin(), src.end(), uint64_t{0}, plus<>{}, [](uint32_t x) { return uint64_t{x} * x; }));
+        }
+    }
+
+    template <class ExPo>
+    void transform_reduce_binary(benchmark::State& state) {
+        const auto src1 = random_vector<uint32_t>(static_cast<size_t>(state.range(0)));
+        const auto src2 = random_vector<uint32_t>(src1.size());
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(src1.data());
+            benchmark::DoNotOptimize(src2.data());
+            benchmark::DoNotOptimize(transform_reduce(ExPo{}, src1.begin(), src1.end(), src2.begin(), uint32_t{0},
+                bit_xor<>{}, [](uint32_t x, uint32_t y) { return x & y; }));
+        }
+    }
+} // namespace
+
+BENCHMARK(transform_unary<execution::sequenced_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(transform_unary<execution::unsequenced_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(transform_unary<execution::parallel_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(transform_unary<execution::parallel_unsequenced_policy>)->Range(1 << 10, 1 << 22);
+
+BENCHMARK(transform_binary<execution::sequenced_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(transform_binary<execution::unsequenced_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(transform_binary<execution::parallel_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(transform_binary<execution::parallel_unsequenced_policy>)->Range(1 << 10, 1 << 22);
+
+BENCHMARK(reduce_max<execution::sequenced_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(reduce_max<execution::unsequenced_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(reduce_max<execution::parallel_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(reduce_max<execution::parallel_unsequenced_policy>)->Range(1 << 10, 1 << 22);
+
+BENCHMARK(transform_reduce_unary<execution::sequenced_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(transform_reduce_unary<execution::unsequenced_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(transform_reduce_unary<execution::parallel_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(transform_reduce_unary<execution::parallel_unsequenced_policy>)->Range(1 << 10, 1 << 22);
+
+BENCHMARK(transform_reduce_binary<execution::sequenced_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(transform_reduce_binary<execution::unsequenced_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(transform_reduce_binary<execution::parallel_policy>)->Range(1 << 10, 1 << 22);
+BENCHMARK(transform_reduce_binary<execution::parallel_unsequenced_policy>)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_MAIN();
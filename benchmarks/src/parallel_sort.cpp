@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <functional>
+#include <vector>
+
+#include <utility.hpp>
+
+using namespace std;
+
+namespace {
+    enum class distribution { random, sorted, reversed, few_unique };
+
+    template <class T>
+    vector<T> make_input(const distribution dist, const size_t size) {
+        auto result = random_vector<T>(size);
+        switch (dist) {
+        case distribution::random:
+            break;
+        case distribution::sorted:
+            sort(result.begin(), result.end());
+            break;
+        case distribution::reversed:
+            sort(result.begin(), result.end(), greater<>{});
+            break;
+        case distribution::few_unique:
+            for (auto& val : result) {
+                val = static_cast<T>(val % 16);
+            }
+            break;
+        }
+
+        return result;
+    }
+
+    // less<> on an arithmetic type, which takes the radix sort path when parallel
+    template <class ExPo, distribution Dist>
+    void sort_less(benchmark::State& state) {
+        const auto src = make_input<uint32_t>(Dist, static_cast<size_t>(state.range(0)));
+        vector<uint32_t> v(src.size());
+        for (auto _ : state) {
+            copy(src.begin(), src.end(), v.begin()); // restore the distribution; cheap next to sorting
+            sort(ExPo{}, v.begin(), v.end());
+            benchmark::DoNotOptimize(v.data());
+        }
+    }
+
+    // an opaque comparator, which takes the quicksort path when parallel
+    template <class ExPo, distribution Dist>
+    void sort_comparator(benchmark::State& state) {
+        const auto src = make_input<uint32_t>(Dist, static_cast<size_t>(state.range(0)));
+        vector<uint32_t> v(src.size());
+        for (auto _ : state) {
+            copy(src.begin(), src.end(), v.begin()); // restore the distribution; cheap next to sorting
+            sort(ExPo{}, v.begin(), v.end(), [](uint32_t x, uint32_t y) { return x < y; });
+            benchmark::DoNotOptimize(v.data());
+        }
+    }
+} // namespace
+
+BENCHMARK(sort_less<execution::sequenced_policy, distribution::random>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_less<execution::parallel_policy, distribution::random>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_less<execution::sequenced_policy, distribution::sorted>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_less<execution::parallel_policy, distribution::sorted>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_less<execution::sequenced_policy, distribution::reversed>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_less<execution::parallel_policy, distribution::reversed>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_less<execution::sequenced_policy, distribution::few_unique>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_less<execution::parallel_policy, distribution::few_unique>)->Range(1 << 16, 1 << 24);
+
+BENCHMARK(sort_comparator<execution::sequenced_policy, distribution::random>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_comparator<execution::parallel_policy, distribution::random>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_comparator<execution::sequenced_policy, distribution::sorted>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_comparator<execution::parallel_policy, distribution::sorted>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_comparator<execution::sequenced_policy, distribution::reversed>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_comparator<execution::parallel_policy, distribution::reversed>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_comparator<execution::sequenced_policy, distribution::few_unique>)->Range(1 << 16, 1 << 24);
+BENCHMARK(sort_comparator<execution::parallel_policy, distribution::few_unique>)->Range(1 << 16, 1 << 24);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures constructing large arrays in freshly allocated memory, where the cost is dominated by page faults. On NUMA
+// machines, the first_touch benchmarks also show the effect of the constructing policy on a later parallel pass: pages
+// are placed on the node of the thread that first touches them, so memory constructed serially lives on one node.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    struct particle { // not trivially constructible, so construction can't be replaced by memset or memmove
+        double position[3];
+        double velocity[3];
+
+        explicit particle(const double seed) noexcept
+            : position{seed, seed + 1.0, seed + 2.0}, velocity{-seed, -seed - 1.0, -seed - 2.0} {}
+        particle(const particle& other) noexcept
+            : position{other.position[0], other.position[1], other.position[2]},
+              velocity{other.velocity[0], other.velocity[1], other.velocity[2]} {}
+        particle& operator=(const particle&) = delete;
+    };
+
+    struct raw_buffer { // freshly allocated memory, so that its pages are first touched by the benchmarked algorithm
+        particle* data;
+        size_t size;
+
+        explicit raw_buffer(const size_t n)
+            : data{static_cast<particle*>(::operator new(n * sizeof(particle)))}, size{n} {}
+        raw_buffer(const raw_buffer&)            = delete;
+        raw_buffer& operator=(const raw_buffer&) = delete;
+        ~raw_buffer() {
+            ::operator delete(data);
+        }
+    };
+
+    template <class ExPo>
+    void uninitialized_fill_fresh(benchmark::State& state) {
+        const auto n = static_cast<size_t>(state.range(0));
+        const particle value{1.0};
+        for (auto _ : state) {
+            raw_buffer buf(n);
+            uninitialized_fill(ExPo{}, buf.data, buf.data + n, value);
+            benchmark::DoNotOptimize(buf.data);
+            // particle is trivially destructible; no destroy needed before the memory is freed
+        }
+    }
+
+    template <class ExPo>
+    void uninitialized_copy_fresh(benchmark::State& state) {
+        const auto n = static_cast<size_t>(state.range(0));
+        const vector<particle> src(n, particle{1.0});
+        for (auto _ : state) {
+            raw_buffer buf(n);
+            uninitialized_copy(ExPo{}, src.begin(), src.end(), buf.data);
+            benchmark::DoNotOptimize(buf.data);
+        }
+    }
+
+    template <class ExPo>
+    void first_touch_then_parallel_reduce(benchmark::State& state) {
+        // constructs with ExPo (untimed), then times a parallel pass over the result
+        const auto n = static_cast<size_t>(state.range(0));
+        const particle value{1.0};
+        raw_buffer buf(n);
+        uninitialized_fill(ExPo{}, buf.data, buf.data + n, value);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(buf.data);
+            benchmark::DoNotOptimize(transform_reduce(execution::par, buf.data, buf.data + n, 0.0, plus<>{},
+                [](const particle& p) { return p.position[0] * p.velocity[0]; }));
+        }
+    }
+} // namespace
+
+BENCHMARK(uninitialized_fill_fresh<execution::sequenced_policy>)->Range(1 << 12, 1 << 22);
+BENCHMARK(uninitialized_fill_fresh<execution::parallel_policy>)->Range(1 << 12, 1 << 22);
+BENCHMARK(uninitialized_copy_fresh<execution::sequenced_policy>)->Range(1 << 12, 1 << 22);
+BENCHMARK(uninitialized_copy_fresh<execution::parallel_policy>)->Range(1 << 12, 1 << 22);
+BENCHMARK(first_touch_then_parallel_reduce<execution::sequenced_policy>)->Range(1 << 16, 1 << 24);
+BENCHMARK(first_touch_then_parallel_reduce<execution::parallel_policy>)->Range(1 << 16, 1 << 24);
+
+BENCHMARK_MAIN();
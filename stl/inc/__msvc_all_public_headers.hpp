@@ -92,6 +92,10 @@
 #include <exception>
 #include <expected>
 #include <filesystem>
+#include <flat_hash_map>
+#include <flat_hash_set>
+#include <flat_map>
+#include <flat_set>
 #include <format>
 #include <forward_list>
 #include <fstream>
@@ -111,6 +115,9 @@
 #include <memory>
 #include <memory_resource>
 #include <new>
+#include <node_cache>
+#include <node_hash_map>
+#include <node_hash_set>
 #include <numeric>
 #include <optional>
 #include <ostream>
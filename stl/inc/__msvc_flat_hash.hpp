@@ -0,0 +1,857 @@
+// __msvc_flat_hash.hpp internal header
+
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef __MSVC_FLAT_HASH_HPP
+#define __MSVC_FLAT_HASH_HPP
+#include <yvals_core.h>
+#if _STL_COMPILER_PREPROCESSOR
+
+#if !_HAS_CXX17
+_EMIT_STL_WARNING(STL4038, "The contents of <__msvc_flat_hash.hpp> are available only with C++17 or later.");
+#else // ^^^ !_HAS_CXX17 / _HAS_CXX17 vvv
+#include <__msvc_bit_utils.hpp>
+#include <xhash>
+
+#ifdef _M_CEE_PURE
+// no intrinsics for /clr:pure
+#elif defined(_M_ARM64) || defined(_M_ARM64EC)
+// TRANSITION, control byte groups are matched one byte at a time on ARM64
+#elif defined(_M_IX86) || defined(_M_X64)
+#define _FLAT_HASH_USING_SSE2
+#include <emmintrin.h>
+#endif // ^^^ defined(_M_IX86) || defined(_M_X64) ^^^
+
+#pragma pack(push, _CRT_PACKING)
+#pragma warning(push, _STL_WARNING_LEVEL)
+#pragma warning(disable : _STL_DISABLED_WARNINGS)
+_STL_DISABLE_CLANG_WARNINGS
+#pragma push_macro("new")
+#undef new
+
+_STD_BEGIN
+// Each slot of a _Flat_hash has a control byte. A full slot's control byte holds the low 7 bits of the (mixed) hash of
+// its key, so a whole group of candidate slots can be filtered with a single comparison before touching any key.
+// The control bytes are followed by one sentinel byte (which stops iteration) and enough empty padding bytes to let a
+// group be loaded starting at any slot.
+_INLINE_VAR constexpr signed char _Flat_hash_empty    = -128;
+_INLINE_VAR constexpr signed char _Flat_hash_deleted  = -2;
+_INLINE_VAR constexpr signed char _Flat_hash_sentinel = -1;
+
+_INLINE_VAR constexpr size_t _Flat_hash_group_width = 16;
+
+// control bytes of every table without storage; iteration stops at the leading sentinel
+_INLINE_VAR constexpr signed char _Flat_hash_empty_ctrl[_Flat_hash_group_width] = {_Flat_hash_sentinel,
+    _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty,
+    _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty,
+    _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty};
+
+_NODISCARD inline size_t _Flat_hash_mix(size_t _Hashval) noexcept {
+    // spread the entropy of a user-provided hash across all bits, as both the low and the high bits are consumed
+    constexpr size_t _Multiplier = static_cast<size_t>(sizeof(size_t) == 8 ? 0x9E37'79B9'7F4A'7C15ULL : 0x9E37'79B9U);
+    _Hashval *= _Multiplier;
+    return _Hashval ^ (_Hashval >> (sizeof(size_t) * CHAR_BIT / 2));
+}
+
+_NODISCARD constexpr signed char _Flat_hash_tag(const size_t _Hashval) noexcept {
+    return static_cast<signed char>(_Hashval & 0x7F);
+}
+
+struct _Flat_hash_group { // _Flat_hash_group_width control bytes, matched all at once
+#ifdef _FLAT_HASH_USING_SSE2
+    explicit _Flat_hash_group(const signed char* const _Pos) noexcept
+        : _Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_Pos))) {}
+
+    _NODISCARD unsigned int _Match(const signed char _Tag) const noexcept {
+        return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(_Tag), _Ctrl)));
+    }
+
+    _NODISCARD unsigned int _Match_empty() const noexcept {
+        return _Match(_Flat_hash_empty);
+    }
+
+    _NODISCARD unsigned int _Match_empty_or_deleted() const noexcept {
+        return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(_Flat_hash_sentinel), _Ctrl)));
+    }
+
+    _NODISCARD unsigned int _Match_full_or_sentinel() const noexcept {
+        return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpgt_epi8(_Ctrl, _mm_set1_epi8(_Flat_hash_deleted))));
+    }
+
+    __m128i _Ctrl;
+#else // ^^^ defined(_FLAT_HASH_USING_SSE2) / !defined(_FLAT_HASH_USING_SSE2) vvv
+    explicit _Flat_hash_group(const signed char* const _Pos) noexcept {
+        for (size_t _Idx = 0; _Idx < _Flat_hash_group_width; ++_Idx) {
+            _Ctrl[_Idx] = _Pos[_Idx];
+        }
+    }
+
+    template <class _Pr>
+    _NODISCARD unsigned int _Match_if(_Pr _Pred) const noexcept {
+        unsigned int _Mask = 0;
+        for (size_t _Idx = 0; _Idx < _Flat_hash_group_width; ++_Idx) {
+            if (_Pred(_Ctrl[_Idx])) {
+                _Mask |= 1U << _Idx;
+            }
+        }
+
+        return _Mask;
+    }
+
+    _NODISCARD unsigned int _Match(const signed char _Tag) const noexcept {
+        return _Match_if([_Tag](const signed char _Byte) { return _Byte == _Tag; });
+    }
+
+    _NODISCARD unsigned int _Match_empty() const noexcept {
+        return _Match(_Flat_hash_empty);
+    }
+
+    _NODISCARD unsigned int _Match_empty_or_deleted() const noexcept {
+        return _Match_if([](const signed char _Byte) { return _Byte < _Flat_hash_sentinel; });
+    }
+
+    _NODISCARD unsigned int _Match_full_or_sentinel() const noexcept {
+        return _Match_if([](const signed char _Byte) { return _Byte > _Flat_hash_deleted; });
+    }
+
+    signed char _Ctrl[_Flat_hash_group_width];
+#endif // ^^^ !defined(_FLAT_HASH_USING_SSE2) ^^^
+};
+
+_NODISCARD inline size_t _Flat_hash_skip_to_full(const signed char* const _Pos) noexcept {
+    // returns the distance from _Pos to the nearest full slot or the sentinel
+    for (size_t _Offset = 0;; _Offset += _Flat_hash_group_width) {
+        const unsigned int _Mask = _Flat_hash_group{_Pos + _Offset}._Match_full_or_sentinel();
+        if (_Mask != 0) {
+            return _Offset + static_cast<size_t>(_Countr_zero(_Mask));
+        }
+    }
+}
+
+template <class _Ty>
+class _Flat_hash_const_iterator {
+public:
+    using iterator_category = forward_iterator_tag;
+    using value_type        = _Ty;
+    using difference_type   = ptrdiff_t;
+    using pointer           = const _Ty*;
+    using reference         = const _Ty&;
+
+    _Flat_hash_const_iterator() noexcept = default;
+    _Flat_hash_const_iterator(const signed char* const _Ctrlarg, _Ty* const _Slotarg) noexcept
+        : _Ctrl(_Ctrlarg), _Slot(_Slotarg) {}
+
+    _NODISCARD reference operator*() const noexcept {
+        return *_Slot;
+    }
+
+    _NODISCARD pointer operator->() const noexcept {
+        return _Slot;
+    }
+
+    _Flat_hash_const_iterator& operator++() noexcept {
+        const size_t _Skip = _Flat_hash_skip_to_full(_Ctrl + 1) + 1;
+        _Ctrl += _Skip;
+        _Slot += _Skip;
+        return *this;
+    }
+
+    _Flat_hash_const_iterator operator++(int) noexcept {
+        _Flat_hash_const_iterator _Tmp = *this;
+        ++*this;
+        return _Tmp;
+    }
+
+    _NODISCARD bool operator==(const _Flat_hash_const_iterator& _Right) const noexcept {
+        return _Ctrl == _Right._Ctrl;
+    }
+
+#if !_HAS_CXX20
+    _NODISCARD bool operator!=(const _Flat_hash_const_iterator& _Right) const noexcept {
+        return _Ctrl != _Right._Ctrl;
+    }
+#endif // !_HAS_CXX20
+
+    const signed char* _Ctrl = nullptr;
+    _Ty* _Slot               = nullptr;
+};
+
+template <class _Ty>
+class _Flat_hash_iterator : public _Flat_hash_const_iterator<_Ty> {
+public:
+    using _Mybase           = _Flat_hash_const_iterator<_Ty>;
+    using iterator_category = forward_iterator_tag;
+    using value_type        = _Ty;
+    using difference_type   = ptrdiff_t;
+    using pointer           = _Ty*;
+    using reference         = _Ty&;
+
+    using _Mybase::_Mybase;
+
+    _NODISCARD reference operator*() const noexcept {
+        return *this->_Slot;
+    }
+
+    _NODISCARD pointer operator->() const noexcept {
+        return this->_Slot;
+    }
+
+    _Flat_hash_iterator& operator++() noexcept {
+        _Mybase::operator++();
+        return *this;
+    }
+
+    _Flat_hash_iterator operator++(int) noexcept {
+        _Flat_hash_iterator _Tmp = *this;
+        _Mybase::operator++();
+        return _Tmp;
+    }
+};
+
+template <class _Ty>
+struct _Flat_hash_val { // storage of a _Flat_hash
+    signed char* _Ctrl  = nullptr; // _Capacity control bytes, the sentinel, then padding
+    _Ty* _Slots         = nullptr;
+    size_t _Capacity    = 0; // 0 or a power of 2 no less than _Flat_hash_group_width
+    size_t _Size        = 0;
+    size_t _Growth_left = 0; // number of empty slots that may still be filled before the table must grow
+
+    void _Swap_val(_Flat_hash_val& _Right) noexcept {
+        _STD swap(_Ctrl, _Right._Ctrl);
+        _STD swap(_Slots, _Right._Slots);
+        _STD swap(_Capacity, _Right._Capacity);
+        _STD swap(_Size, _Right._Size);
+        _STD swap(_Growth_left, _Right._Growth_left);
+    }
+
+    void _Take_contents(_Flat_hash_val& _Right) noexcept {
+        _Ctrl        = _STD exchange(_Right._Ctrl, nullptr);
+        _Slots       = _STD exchange(_Right._Slots, nullptr);
+        _Capacity    = _STD exchange(_Right._Capacity, size_t{0});
+        _Size        = _STD exchange(_Right._Size, size_t{0});
+        _Growth_left = _STD exchange(_Right._Growth_left, size_t{0});
+    }
+};
+
+template <class _Traits>
+class _Flat_hash { // open-addressing hash table holding values in place, probed a group of control bytes at a time
+protected:
+    using _Alty               = _Rebind_alloc_t<typename _Traits::allocator_type, typename _Traits::value_type>;
+    using _Alty_traits        = allocator_traits<_Alty>;
+    using _Alctrl             = _Rebind_alloc_t<_Alty, signed char>;
+    using _Alctrl_traits      = allocator_traits<_Alctrl>;
+    using _Key_compare        = typename _Traits::key_compare;
+    using _Mutable_value_type = typename _Traits::_Mutable_value_type;
+    using _Scary_val          = _Flat_hash_val<typename _Traits::value_type>;
+
+public:
+    using key_type = typename _Traits::key_type;
+
+    using value_type      = typename _Traits::value_type;
+    using allocator_type  = typename _Traits::allocator_type;
+    using size_type       = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer         = typename _Alty_traits::pointer;
+    using const_pointer   = typename _Alty_traits::const_pointer;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    using iterator = conditional_t<is_same_v<key_type, value_type>, _Flat_hash_const_iterator<value_type>,
+        _Flat_hash_iterator<value_type>>;
+    using const_iterator = _Flat_hash_const_iterator<value_type>;
+
+protected:
+    _Flat_hash(const _Key_compare& _Parg, const allocator_type& _Al)
+        : _Mypair(_One_then_variadic_args_t{}, _Traits(_Parg), _One_then_variadic_args_t{}, _Al) {}
+
+    _Flat_hash(const _Flat_hash& _Right, const allocator_type& _Al)
+        : _Mypair(_One_then_variadic_args_t{}, _Right._Mypair._Get_first(), _One_then_variadic_args_t{}, _Al) {
+        _TRY_BEGIN
+        _Copy_from(_Right);
+        _CATCH_ALL
+        _Tidy();
+        _RERAISE;
+        _CATCH_END
+    }
+
+    _Flat_hash(_Flat_hash&& _Right)
+        : _Mypair(_One_then_variadic_args_t{}, _Right._Mypair._Get_first(), _One_then_variadic_args_t{},
+            _STD move(_Right._Getal())) {
+        _Get_scary()->_Take_contents(*_Right._Get_scary());
+    }
+
+    _Flat_hash(_Flat_hash&& _Right, const allocator_type& _Al)
+        : _Mypair(_One_then_variadic_args_t{}, _Right._Mypair._Get_first(), _One_then_variadic_args_t{}, _Al) {
+        if constexpr (_Alty_traits::is_always_equal::value) {
+            _Get_scary()->_Take_contents(*_Right._Get_scary());
+        } else {
+            if (_Getal() == _Right._Getal()) {
+                _Get_scary()->_Take_contents(*_Right._Get_scary());
+            } else {
+                _TRY_BEGIN
+                _Move_from(_Right);
+                _CATCH_ALL
+                _Tidy();
+                _RERAISE;
+                _CATCH_END
+            }
+        }
+    }
+
+    _Flat_hash& operator=(const _Flat_hash& _Right) {
+        if (this != _STD addressof(_Right)) {
+            _Tidy();
+            _Pocca(_Getal(), _Right._Getal());
+            _Mypair._Get_first() = _Right._Mypair._Get_first();
+            _Copy_from(_Right);
+        }
+
+        return *this;
+    }
+
+    _Flat_hash& operator=(_Flat_hash&& _Right) noexcept(
+        _Alty_traits::is_always_equal::value && is_nothrow_move_assignable_v<_Key_compare>) {
+        if (this != _STD addressof(_Right)) {
+            _Tidy();
+            _Mypair._Get_first() = _STD move(_Right._Mypair._Get_first());
+            constexpr auto _Pocma_val = _Choose_pocma_v<_Alty>;
+            if constexpr (_Pocma_val == _Pocma_values::_No_propagate_allocators) {
+                if (_Getal() != _Right._Getal()) {
+                    _Move_from(_Right);
+                    return *this;
+                }
+            }
+
+            _Pocma(_Getal(), _Right._Getal());
+            _Get_scary()->_Take_contents(*_Right._Get_scary());
+        }
+
+        return *this;
+    }
+
+public:
+    ~_Flat_hash() noexcept {
+        _Tidy();
+    }
+
+    void swap(_Flat_hash& _Right) noexcept(_Is_nothrow_swappable<_Key_compare>::value) /* strengthened */ {
+        if (this != _STD addressof(_Right)) {
+            _Pocs(_Getal(), _Right._Getal());
+            _Get_scary()->_Swap_val(*_Right._Get_scary());
+            _Mypair._Get_first().swap(_Right._Mypair._Get_first());
+        }
+    }
+
+    _NODISCARD allocator_type get_allocator() const noexcept {
+        return static_cast<allocator_type>(_Getal());
+    }
+
+    _NODISCARD iterator begin() noexcept {
+        return _Make_iter<iterator>(0);
+    }
+
+    _NODISCARD const_iterator begin() const noexcept {
+        return _Make_iter<const_iterator>(0);
+    }
+
+    _NODISCARD iterator end() noexcept {
+        return _Make_end<iterator>();
+    }
+
+    _NODISCARD const_iterator end() const noexcept {
+        return _Make_end<const_iterator>();
+    }
+
+    _NODISCARD const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    _NODISCARD const_iterator cend() const noexcept {
+        return end();
+    }
+
+    _NODISCARD_EMPTY_MEMBER bool empty() const noexcept {
+        return _Get_scary()->_Size == 0;
+    }
+
+    _NODISCARD size_type size() const noexcept {
+        return _Get_scary()->_Size;
+    }
+
+    _NODISCARD size_type max_size() const noexcept {
+        return (_STD min)(static_cast<size_type>(_Alty_traits::max_size(_Getal()) / 2),
+            static_cast<size_type>((numeric_limits<difference_type>::max)() / 2));
+    }
+
+    _NODISCARD size_type capacity() const noexcept { // number of slots, full or not
+        return _Get_scary()->_Capacity;
+    }
+
+    _NODISCARD float load_factor() const noexcept {
+        const size_type _Capacity = capacity();
+        return _Capacity == 0 ? 0.0f : static_cast<float>(size()) / static_cast<float>(_Capacity);
+    }
+
+    _NODISCARD float max_load_factor() const noexcept {
+        return 0.875f;
+    }
+
+    void reserve(const size_type _Count) { // ensure that _Count elements fit without further rehashing
+        const auto _Scary = _Get_scary();
+        if (_Count > _Scary->_Size + _Scary->_Growth_left) {
+            _Rehash(_Capacity_for((_STD max)(_Count, _Scary->_Size)));
+        }
+    }
+
+    void rehash(const size_type _Count) { // rebuild the table with room for at least _Count and size() elements
+        const auto _Scary = _Get_scary();
+        if (_Count == 0 && _Scary->_Size == 0) {
+            _Tidy();
+            return;
+        }
+
+        _Rehash(_Capacity_for((_STD max)(_Count, _Scary->_Size)));
+    }
+
+    void clear() noexcept {
+        const auto _Scary = _Get_scary();
+        if (_Scary->_Size == 0) {
+            return;
+        }
+
+        _Destroy_elements();
+        _Fill_ctrl(_Scary->_Ctrl, _Scary->_Capacity);
+        _Scary->_Size        = 0;
+        _Scary->_Growth_left = _Growth_for(_Scary->_Capacity);
+    }
+
+    template <class... _Valtys>
+    pair<iterator, bool> emplace(_Valtys&&... _Vals) {
+        using _In_place_key_extractor = typename _Traits::template _In_place_key_extractor<_Remove_cvref_t<_Valtys>...>;
+        if constexpr (_In_place_key_extractor::_Extractable) {
+            const auto& _Keyval = _In_place_key_extractor::_Extract(_Vals...);
+            return _Emplace_key(_Keyval, _STD forward<_Valtys>(_Vals)...);
+        } else {
+            _Alty& _Al = _Getal();
+            _Alloc_temporary2<_Alty> _Tmp{_Al, _STD forward<_Valtys>(_Vals)...};
+            const auto& _Keyval = _Traits::_Kfn(_Tmp._Get_value());
+            return _Emplace_key(_Keyval, reinterpret_cast<_Mutable_value_type&&>(_Tmp._Get_value()));
+        }
+    }
+
+    template <class... _Valtys>
+    iterator emplace_hint(const_iterator, _Valtys&&... _Vals) { // the hint does not help an open-addressing table
+        return emplace(_STD forward<_Valtys>(_Vals)...).first;
+    }
+
+    pair<iterator, bool> insert(const value_type& _Val) {
+        return _Emplace_key(_Traits::_Kfn(_Val), _Val);
+    }
+
+    pair<iterator, bool> insert(value_type&& _Val) {
+        return _Emplace_key(_Traits::_Kfn(_Val), _STD move(_Val));
+    }
+
+    iterator insert(const_iterator, const value_type& _Val) {
+        return insert(_Val).first;
+    }
+
+    iterator insert(const_iterator, value_type&& _Val) {
+        return insert(_STD move(_Val)).first;
+    }
+
+    template <class _Iter>
+    void insert(_Iter _First, _Iter _Last) {
+        _Adl_verify_range(_First, _Last);
+        auto _UFirst      = _Get_unwrapped(_First);
+        const auto _ULast = _Get_unwrapped(_Last);
+        if constexpr (_Is_ranges_fwd_iter_v<decltype(_UFirst)>) {
+            _Reserve_for_insert(static_cast<size_type>(_STD distance(_UFirst, _ULast)));
+        }
+
+        _Insert_range_unchecked(_UFirst, _ULast);
+    }
+
+    void insert(initializer_list<value_type> _Ilist) {
+        insert(_Ilist.begin(), _Ilist.end());
+    }
+
+#if _HAS_CXX20 && defined(__cpp_lib_concepts) // TRANSITION, GH-395
+    template <_RANGES input_range _Rng>
+    void insert_range(_Rng&& _Range) { // insert a whole range, growing the table at most once when its size is known
+        if constexpr (_RANGES sized_range<_Rng> || _RANGES forward_range<_Rng>) {
+            _Reserve_for_insert(static_cast<size_type>(_RANGES distance(_Range)));
+        }
+
+        _Insert_range_unchecked(_RANGES _Ubegin(_Range), _RANGES _Uend(_Range));
+    }
+#else // ^^^ _HAS_CXX20 && defined(__cpp_lib_concepts) / !_HAS_CXX20 || !defined(__cpp_lib_concepts) vvv
+    template <class _Rng>
+    void insert_range(_Rng&& _Range) { // insert a whole range, growing the table at most once when its size is known
+        insert(_STD begin(_Range), _STD end(_Range));
+    }
+#endif // ^^^ !_HAS_CXX20 || !defined(__cpp_lib_concepts) ^^^
+
+    iterator erase(const_iterator _Where) noexcept /* strengthened */ {
+        const size_type _Idx = static_cast<size_type>(_Where._Ctrl - _Get_scary()->_Ctrl);
+        _Erase_slot(_Idx);
+        return _Make_iter<iterator>(_Idx + 1);
+    }
+
+    template <class _Iter = iterator, enable_if_t<!is_same_v<_Iter, const_iterator>, int> = 0>
+    iterator erase(iterator _Where) noexcept /* strengthened */ {
+        return erase(const_iterator{_Where});
+    }
+
+    iterator erase(const_iterator _First, const const_iterator _Last) noexcept /* strengthened */ {
+        while (_First != _Last) {
+            _First = erase(_First);
+        }
+
+        return iterator{_Last._Ctrl, _Last._Slot};
+    }
+
+    size_type erase(const key_type& _Keyval) noexcept(
+        _Nothrow_hash<_Traits, key_type> && _Nothrow_compare<_Traits, key_type, key_type>) /* strengthened */ {
+        const size_type _Idx = _Find_index(_Keyval, _Flat_hash_mix(_Traitsobj()(_Keyval)));
+        if (_Idx == _Get_scary()->_Capacity) {
+            return 0;
+        }
+
+        _Erase_slot(_Idx);
+        return 1;
+    }
+
+    template <class _Keyty = void>
+    _NODISCARD iterator find(typename _Traits::template _Deduce_key<_Keyty> _Keyval) {
+        return _Make_iter_at<iterator>(_Find_index(_Keyval, _Flat_hash_mix(_Traitsobj()(_Keyval))));
+    }
+
+    template <class _Keyty = void>
+    _NODISCARD const_iterator find(typename _Traits::template _Deduce_key<_Keyty> _Keyval) const {
+        return _Make_iter_at<const_iterator>(_Find_index(_Keyval, _Flat_hash_mix(_Traitsobj()(_Keyval))));
+    }
+
+    template <class _Keyty = void>
+    _NODISCARD bool contains(typename _Traits::template _Deduce_key<_Keyty> _Keyval) const {
+        return _Find_index(_Keyval, _Flat_hash_mix(_Traitsobj()(_Keyval))) != _Get_scary()->_Capacity;
+    }
+
+    template <class _Keyty = void>
+    _NODISCARD size_type count(typename _Traits::template _Deduce_key<_Keyty> _Keyval) const {
+        return contains<_Keyty>(_Keyval);
+    }
+
+protected:
+    template <class _Keyty>
+    _NODISCARD size_type _Find_index(const _Keyty& _Keyval, const size_t _Hashval) const {
+        // returns the slot holding _Keyval, or the capacity if there is none
+        const auto _Scary = _Get_scary();
+        if (_Scary->_Capacity == 0) {
+            return 0;
+        }
+
+        const signed char _Tag      = _Flat_hash_tag(_Hashval);
+        const size_type _Group_mask = _Scary->_Capacity / _Flat_hash_group_width - 1;
+        size_type _Group            = (_Hashval >> 7) & _Group_mask;
+        for (size_type _Step = 1;; ++_Step) {
+            const size_type _Base = _Group * _Flat_hash_group_width;
+            const _Flat_hash_group _Ctrl{_Scary->_Ctrl + _Base};
+            for (unsigned int _Mask = _Ctrl._Match(_Tag); _Mask != 0; _Mask &= _Mask - 1) {
+                const size_type _Idx = _Base + static_cast<size_type>(_Countr_zero(_Mask));
+                if (!_Traitsobj()(_Keyval, _Traits::_Kfn(_Scary->_Slots[_Idx]))) {
+                    return _Idx;
+                }
+            }
+
+            if (_Ctrl._Match_empty() != 0) { // an insertion would have stopped here, so _Keyval is absent
+                return _Scary->_Capacity;
+            }
+
+            _Group = (_Group + _Step) & _Group_mask; // triangular probing visits every group exactly once
+        }
+    }
+
+    _NODISCARD size_type _Find_insert_slot(const size_t _Hashval) const noexcept {
+        // returns the first empty or deleted slot on the probe sequence of _Hashval
+        const auto _Scary           = _Get_scary();
+        const size_type _Group_mask = _Scary->_Capacity / _Flat_hash_group_width - 1;
+        size_type _Group            = (_Hashval >> 7) & _Group_mask;
+        for (size_type _Step = 1;; ++_Step) {
+            const size_type _Base    = _Group * _Flat_hash_group_width;
+            const unsigned int _Mask = _Flat_hash_group{_Scary->_Ctrl + _Base}._Match_empty_or_deleted();
+            if (_Mask != 0) {
+                return _Base + static_cast<size_type>(_Countr_zero(_Mask));
+            }
+
+            _Group = (_Group + _Step) & _Group_mask;
+        }
+    }
+
+    template <class _Keyty, class... _Valtys>
+    pair<iterator, bool> _Emplace_key(const _Keyty& _Keyval, _Valtys&&... _Vals) {
+        // insert a value constructed from _Vals... unless an element equivalent to _Keyval is present
+        const size_t _Hashval = _Flat_hash_mix(_Traitsobj()(_Keyval));
+        const size_type _Idx  = _Find_index(_Keyval, _Hashval);
+        if (_Idx != _Get_scary()->_Capacity) {
+            return {_Make_iter_at<iterator>(_Idx), false};
+        }
+
+        return {_Make_iter_at<iterator>(_Insert_new(_Hashval, _STD forward<_Valtys>(_Vals)...)), true};
+    }
+
+    template <class... _Valtys>
+    size_type _Insert_new(const size_t _Hashval, _Valtys&&... _Vals) {
+        // insert a value known to be absent, returning its slot
+        const auto _Scary = _Get_scary();
+        size_type _Idx    = 0;
+        if (_Scary->_Capacity != 0) {
+            _Idx = _Find_insert_slot(_Hashval);
+        }
+
+        // reusing a deleted slot does not count against the load, but filling an empty one does
+        if (_Scary->_Growth_left == 0 && (_Scary->_Capacity == 0 || _Scary->_Ctrl[_Idx] == _Flat_hash_empty)) {
+            // _Vals may refer to elements of this table, so construct the new value before rehashing moves them
+            _Alloc_temporary2<_Alty> _Tmp{_Getal(), _STD forward<_Valtys>(_Vals)...};
+            _Rehash_for_growth();
+            _Idx = _Find_insert_slot(_Hashval);
+            _Alty_traits::construct(
+                _Getal(), _Scary->_Slots + _Idx, reinterpret_cast<_Mutable_value_type&&>(_Tmp._Get_value()));
+        } else {
+            _Alty_traits::construct(_Getal(), _Scary->_Slots + _Idx, _STD forward<_Valtys>(_Vals)...);
+        }
+
+        if (_Scary->_Ctrl[_Idx] == _Flat_hash_empty) {
+            --_Scary->_Growth_left;
+        }
+
+        _Scary->_Ctrl[_Idx] = _Flat_hash_tag(_Hashval);
+        ++_Scary->_Size;
+        return _Idx;
+    }
+
+    template <class _Iter, class _Sent>
+    void _Insert_range_unchecked(_Iter _First, const _Sent _Last) {
+        for (; _First != _Last; ++_First) {
+            emplace(*_First);
+        }
+    }
+
+    void _Reserve_for_insert(const size_type _Count) {
+        const auto _Scary = _Get_scary();
+        if (_Count > _Scary->_Growth_left) {
+            reserve(_Scary->_Size + _Count);
+        }
+    }
+
+    void _Erase_slot(const size_type _Idx) noexcept {
+        // A probe stops at the first group with an empty slot, so a slot may only become empty again if no probe can
+        // have passed over its group, which is the case exactly when that group still has an empty slot.
+        const auto _Scary = _Get_scary();
+        _Alty_traits::destroy(_Getal(), _Scary->_Slots + _Idx);
+        const size_type _Base = _Idx & ~(_Flat_hash_group_width - 1);
+        if (_Flat_hash_group{_Scary->_Ctrl + _Base}._Match_empty() != 0) {
+            _Scary->_Ctrl[_Idx] = _Flat_hash_empty;
+            ++_Scary->_Growth_left;
+        } else {
+            _Scary->_Ctrl[_Idx] = _Flat_hash_deleted;
+        }
+
+        --_Scary->_Size;
+    }
+
+    _NODISCARD static size_type _Growth_for(const size_type _Capacity) noexcept {
+        return _Capacity - _Capacity / 8;
+    }
+
+    _NODISCARD size_type _Capacity_for(const size_type _Count) const {
+        // returns the smallest capacity that holds _Count elements within the maximum load factor
+        if (_Count > max_size()) {
+            _Xlength_error("flat_hash too long");
+        }
+
+        size_type _Capacity = _Flat_hash_group_width;
+        while (_Growth_for(_Capacity) < _Count) {
+            _Capacity *= 2;
+        }
+
+        return _Capacity;
+    }
+
+    void _Rehash_for_growth() {
+        const auto _Scary = _Get_scary();
+        if (_Scary->_Capacity != 0 && _Scary->_Size <= _Growth_for(_Scary->_Capacity) / 2) {
+            _Rehash(_Scary->_Capacity); // mostly tombstones; cleaning them up is enough
+        } else {
+            _Rehash(_Capacity_for(_Scary->_Size + 1));
+        }
+    }
+
+    static void _Fill_ctrl(signed char* const _Ctrl, const size_type _Capacity) noexcept {
+        _CSTD memset(_Ctrl, static_cast<unsigned char>(_Flat_hash_empty), _Capacity + _Flat_hash_group_width);
+        _Ctrl[_Capacity] = _Flat_hash_sentinel;
+    }
+
+    void _Rehash(const size_type _New_capacity) { // move every element into a new table of _New_capacity slots
+        const auto _Scary = _Get_scary();
+        _Alty& _Al        = _Getal();
+        _Alctrl _Alc(_Al);
+        _Scary_val _New_val;
+        _New_val._Ctrl  = _Unfancy(_Alctrl_traits::allocate(_Alc, _New_capacity + _Flat_hash_group_width));
+        _TRY_BEGIN
+        _New_val._Slots = _Unfancy(_Alty_traits::allocate(_Al, _New_capacity));
+        _CATCH_ALL
+        _Alctrl_traits::deallocate(
+            _Alc, _Refancy<typename _Alctrl_traits::pointer>(_New_val._Ctrl), _New_capacity + _Flat_hash_group_width);
+        _RERAISE;
+        _CATCH_END
+
+        _Fill_ctrl(_New_val._Ctrl, _New_capacity);
+        _New_val._Capacity    = _New_capacity;
+        _New_val._Growth_left = _Growth_for(_New_capacity);
+
+        _Scary->_Swap_val(_New_val); // _New_val now holds the old table
+        _TRY_BEGIN
+        for (size_type _Idx = 0; _Idx < _New_val._Capacity; ++_Idx) {
+            if (_New_val._Ctrl[_Idx] >= 0) {
+                auto& _Val               = reinterpret_cast<_Mutable_value_type&>(_New_val._Slots[_Idx]);
+                const size_t _Hashval    = _Flat_hash_mix(_Traitsobj()(_Traits::_Kfn(_New_val._Slots[_Idx])));
+                const size_type _New_idx = _Find_insert_slot(_Hashval);
+                _Alty_traits::construct(_Al, _Scary->_Slots + _New_idx, _STD move_if_noexcept(_Val));
+                _Scary->_Ctrl[_New_idx] = _Flat_hash_tag(_Hashval);
+                --_Scary->_Growth_left;
+                ++_Scary->_Size;
+            }
+        }
+        _CATCH_ALL
+        _Tidy(); // destroy the partially built table and restore the old one
+        _Scary->_Swap_val(_New_val);
+        _RERAISE;
+        _CATCH_END
+
+        _Scary->_Swap_val(_New_val);
+        _Tidy(); // free the old table
+        _Scary->_Swap_val(_New_val);
+    }
+
+    void _Copy_from(const _Flat_hash& _Right) {
+        const auto _Right_scary = _Right._Get_scary();
+        if (_Right_scary->_Size == 0) {
+            return;
+        }
+
+        _Rehash(_Capacity_for(_Right_scary->_Size));
+        for (size_type _Idx = 0; _Idx < _Right_scary->_Capacity; ++_Idx) {
+            if (_Right_scary->_Ctrl[_Idx] >= 0) {
+                const auto& _Val = _Right_scary->_Slots[_Idx];
+                _Insert_new(_Flat_hash_mix(_Traitsobj()(_Traits::_Kfn(_Val))), _Val);
+            }
+        }
+    }
+
+    void _Move_from(_Flat_hash& _Right) { // move elements one at a time, for allocators that cannot be stolen from
+        const auto _Right_scary = _Right._Get_scary();
+        if (_Right_scary->_Size == 0) {
+            return;
+        }
+
+        _Rehash(_Capacity_for(_Right_scary->_Size));
+        for (size_type _Idx = 0; _Idx < _Right_scary->_Capacity; ++_Idx) {
+            if (_Right_scary->_Ctrl[_Idx] >= 0) {
+                auto& _Val = reinterpret_cast<_Mutable_value_type&>(_Right_scary->_Slots[_Idx]);
+                _Insert_new(_Flat_hash_mix(_Traitsobj()(_Traits::_Kfn(_Right_scary->_Slots[_Idx]))), _STD move(_Val));
+            }
+        }
+    }
+
+    void _Destroy_elements() noexcept {
+        const auto _Scary = _Get_scary();
+        if constexpr (!is_trivially_destructible_v<value_type> || !_Is_default_allocator<_Alty>::value) {
+            for (size_type _Idx = 0; _Idx < _Scary->_Capacity; ++_Idx) {
+                if (_Scary->_Ctrl[_Idx] >= 0) {
+                    _Alty_traits::destroy(_Getal(), _Scary->_Slots + _Idx);
+                }
+            }
+        }
+    }
+
+    void _Tidy() noexcept { // destroy all elements and free storage
+        const auto _Scary = _Get_scary();
+        if (_Scary->_Capacity == 0) {
+            return;
+        }
+
+        _Destroy_elements();
+        _Alty& _Al = _Getal();
+        _Alctrl _Alc(_Al);
+        _Alty_traits::deallocate(_Al, _Refancy<pointer>(_Scary->_Slots), _Scary->_Capacity);
+        _Alctrl_traits::deallocate(_Alc, _Refancy<typename _Alctrl_traits::pointer>(_Scary->_Ctrl),
+            _Scary->_Capacity + _Flat_hash_group_width);
+        *_Scary = _Scary_val{};
+    }
+
+    template <class _Iter>
+    _NODISCARD _Iter _Make_iter(const size_type _Idx) const noexcept { // first element at or after slot _Idx
+        const auto _Scary = _Get_scary();
+        if (_Scary->_Capacity == 0) {
+            return _Iter{_Flat_hash_empty_ctrl, nullptr};
+        }
+
+        const size_type _Full = _Idx + _Flat_hash_skip_to_full(_Scary->_Ctrl + _Idx);
+        return _Iter{_Scary->_Ctrl + _Full, _Scary->_Slots + _Full};
+    }
+
+    template <class _Iter>
+    _NODISCARD _Iter _Make_iter_at(const size_type _Idx) const noexcept { // element at slot _Idx, or end()
+        const auto _Scary = _Get_scary();
+        if (_Scary->_Capacity == 0) {
+            return _Iter{_Flat_hash_empty_ctrl, nullptr};
+        }
+
+        return _Iter{_Scary->_Ctrl + _Idx, _Scary->_Slots + _Idx};
+    }
+
+    template <class _Iter>
+    _NODISCARD _Iter _Make_end() const noexcept {
+        return _Make_iter_at<_Iter>(_Get_scary()->_Capacity);
+    }
+
+    _NODISCARD _Traits& _Traitsobj() noexcept {
+        return _Mypair._Get_first();
+    }
+
+    _NODISCARD const _Traits& _Traitsobj() const noexcept {
+        return _Mypair._Get_first();
+    }
+
+    _NODISCARD _Alty& _Getal() noexcept {
+        return _Mypair._Myval2._Get_first();
+    }
+
+    _NODISCARD const _Alty& _Getal() const noexcept {
+        return _Mypair._Myval2._Get_first();
+    }
+
+    _NODISCARD _Scary_val* _Get_scary() noexcept {
+        return _STD addressof(_Mypair._Myval2._Myval2);
+    }
+
+    _NODISCARD const _Scary_val* _Get_scary() const noexcept {
+        return _STD addressof(_Mypair._Myval2._Myval2);
+    }
+
+    _Compressed_pair<_Traits, _Compressed_pair<_Alty, _Scary_val>> _Mypair;
+};
+_STD_END
+
+#undef _FLAT_HASH_USING_SSE2
+
+#pragma pop_macro("new")
+_STL_RESTORE_CLANG_WARNINGS
+#pragma warning(pop)
+#pragma pack(pop)
+#endif // ^^^ _HAS_CXX17 ^^^
+
+#endif // _STL_COMPILER_PREPROCESSOR
+#endif // __MSVC_FLAT_HASH_HPP
@@ -0,0 +1,816 @@
+// __msvc_node_hash.hpp internal header
+
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef __MSVC_NODE_HASH_HPP
+#define __MSVC_NODE_HASH_HPP
+#include <yvals_core.h>
+#if _STL_COMPILER_PREPROCESSOR
+
+#if !_HAS_CXX17
+_EMIT_STL_WARNING(STL4038, "The contents of <__msvc_node_hash.hpp> are available only with C++17 or later.");
+#else // ^^^ !_HAS_CXX17 / _HAS_CXX17 vvv
+#include <xhash>
+
+#pragma pack(push, _CRT_PACKING)
+#pragma warning(push, _STL_WARNING_LEVEL)
+#pragma warning(disable : _STL_DISABLED_WARNINGS)
+_STL_DISABLE_CLANG_WARNINGS
+#pragma push_macro("new")
+#undef new
+
+_STD_BEGIN
+// A _Node_hash keeps all of its elements in one singly linked list, in which the elements of a bucket are adjacent.
+// Instead of the first and last iterators that _Hash keeps for every bucket, each bucket holds a single pointer to the
+// link preceding its first element, which halves the size of the bucket array. Every node caches the full hash of its
+// key, so rehashing never calls the hasher and lookups only compare keys whose hashes match.
+template <class _Ty>
+struct _Node_hash_node;
+
+template <class _Ty>
+struct _Node_hash_link { // the part of a node that is shared with the before-begin link of a _Node_hash
+    _Node_hash_node<_Ty>* _Next; // successor node, or nullptr if last
+};
+
+template <class _Ty>
+struct _Node_hash_node : _Node_hash_link<_Ty> { // node of a _Node_hash
+    size_t _Hashval; // the full hash of the key of _Myval
+    _Ty _Myval; // the stored value, constructed and destroyed through the allocator
+
+    _Node_hash_node(const _Node_hash_node&)            = delete;
+    _Node_hash_node& operator=(const _Node_hash_node&) = delete;
+};
+
+template <class _Ty>
+class _Node_hash_const_iterator {
+public:
+    using iterator_category = forward_iterator_tag;
+    using value_type        = _Ty;
+    using difference_type   = ptrdiff_t;
+    using pointer           = const _Ty*;
+    using reference         = const _Ty&;
+
+    _Node_hash_const_iterator() noexcept = default;
+    explicit _Node_hash_const_iterator(_Node_hash_node<_Ty>* const _Pnode) noexcept : _Ptr(_Pnode) {}
+
+    _NODISCARD reference operator*() const noexcept {
+        return _Ptr->_Myval;
+    }
+
+    _NODISCARD pointer operator->() const noexcept {
+        return _STD addressof(_Ptr->_Myval);
+    }
+
+    _Node_hash_const_iterator& operator++() noexcept {
+        _Ptr = _Ptr->_Next;
+        return *this;
+    }
+
+    _Node_hash_const_iterator operator++(int) noexcept {
+        _Node_hash_const_iterator _Tmp = *this;
+        ++*this;
+        return _Tmp;
+    }
+
+    _NODISCARD bool operator==(const _Node_hash_const_iterator& _Right) const noexcept {
+        return _Ptr == _Right._Ptr;
+    }
+
+#if !_HAS_CXX20
+    _NODISCARD bool operator!=(const _Node_hash_const_iterator& _Right) const noexcept {
+        return _Ptr != _Right._Ptr;
+    }
+#endif // !_HAS_CXX20
+
+    _Node_hash_node<_Ty>* _Ptr = nullptr;
+};
+
+template <class _Ty>
+class _Node_hash_iterator : public _Node_hash_const_iterator<_Ty> {
+public:
+    using _Mybase           = _Node_hash_const_iterator<_Ty>;
+    using iterator_category = forward_iterator_tag;
+    using value_type        = _Ty;
+    using difference_type   = ptrdiff_t;
+    using pointer           = _Ty*;
+    using reference         = _Ty&;
+
+    using _Mybase::_Mybase;
+
+    _NODISCARD reference operator*() const noexcept {
+        return this->_Ptr->_Myval;
+    }
+
+    _NODISCARD pointer operator->() const noexcept {
+        return _STD addressof(this->_Ptr->_Myval);
+    }
+
+    _Node_hash_iterator& operator++() noexcept {
+        _Mybase::operator++();
+        return *this;
+    }
+
+    _Node_hash_iterator operator++(int) noexcept {
+        _Node_hash_iterator _Tmp = *this;
+        _Mybase::operator++();
+        return _Tmp;
+    }
+};
+
+template <class _Ty>
+struct _Node_hash_val { // storage of a _Node_hash
+    using _Link = _Node_hash_link<_Ty>;
+    using _Node = _Node_hash_node<_Ty>;
+
+    _Link _Before_begin  = {nullptr}; // _Before_begin._Next is the first element
+    _Link** _Buckets     = nullptr; // for each bucket, the link preceding its first element, or nullptr if empty
+    size_t _Bucket_count = 0; // 0 or a power of 2
+    size_t _Size         = 0;
+
+    _NODISCARD size_t _Bucket_of(const size_t _Hashval) const noexcept {
+        return _Hashval & (_Bucket_count - 1);
+    }
+
+    void _Adopt_front() noexcept {
+        // the bucket of the first element refers to _Before_begin, which does not move along with the elements
+        if (_Before_begin._Next) {
+            _Buckets[_Bucket_of(_Before_begin._Next->_Hashval)] = &_Before_begin;
+        }
+    }
+
+    void _Swap_val(_Node_hash_val& _Right) noexcept {
+        _STD swap(_Before_begin._Next, _Right._Before_begin._Next);
+        _STD swap(_Buckets, _Right._Buckets);
+        _STD swap(_Bucket_count, _Right._Bucket_count);
+        _STD swap(_Size, _Right._Size);
+        _Adopt_front();
+        _Right._Adopt_front();
+    }
+
+    void _Take_contents(_Node_hash_val& _Right) noexcept {
+        _Before_begin._Next = _STD exchange(_Right._Before_begin._Next, nullptr);
+        _Buckets            = _STD exchange(_Right._Buckets, nullptr);
+        _Bucket_count       = _STD exchange(_Right._Bucket_count, size_t{0});
+        _Size               = _STD exchange(_Right._Size, size_t{0});
+        _Adopt_front();
+    }
+};
+
+template <class _Traits>
+class _Node_hash { // hash table of separately allocated nodes, with one pointer per bucket and cached hashes
+protected:
+    using _Alty               = _Rebind_alloc_t<typename _Traits::allocator_type, typename _Traits::value_type>;
+    using _Alty_traits        = allocator_traits<_Alty>;
+    using _Node               = _Node_hash_node<typename _Traits::value_type>;
+    using _Link               = _Node_hash_link<typename _Traits::value_type>;
+    using _Alnode             = _Rebind_alloc_t<_Alty, _Node>;
+    using _Alnode_traits      = allocator_traits<_Alnode>;
+    using _Albucket           = _Rebind_alloc_t<_Alty, _Link*>;
+    using _Albucket_traits    = allocator_traits<_Albucket>;
+    using _Key_compare        = typename _Traits::key_compare;
+    using _Mutable_value_type = typename _Traits::_Mutable_value_type;
+    using _Scary_val          = _Node_hash_val<typename _Traits::value_type>;
+
+    static constexpr size_t _Min_buckets = 8; // must be a positive power of 2
+
+public:
+    using key_type = typename _Traits::key_type;
+
+    using value_type      = typename _Traits::value_type;
+    using allocator_type  = typename _Traits::allocator_type;
+    using size_type       = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer         = typename _Alty_traits::pointer;
+    using const_pointer   = typename _Alty_traits::const_pointer;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    using iterator = conditional_t<is_same_v<key_type, value_type>, _Node_hash_const_iterator<value_type>,
+        _Node_hash_iterator<value_type>>;
+    using const_iterator = _Node_hash_const_iterator<value_type>;
+
+protected:
+    _Node_hash(const _Key_compare& _Parg, const allocator_type& _Al)
+        : _Mypair(_One_then_variadic_args_t{}, _Traits(_Parg), _One_then_variadic_args_t{}, _Al) {
+        _Max_bucket_size() = 1.0f;
+    }
+
+    _Node_hash(const _Node_hash& _Right, const allocator_type& _Al)
+        : _Mypair(_One_then_variadic_args_t{}, _Right._Mypair._Get_first(), _One_then_variadic_args_t{}, _Al) {
+        _Copy_from(_Right);
+    }
+
+    _Node_hash(_Node_hash&& _Right)
+        : _Mypair(_One_then_variadic_args_t{}, _Right._Mypair._Get_first(), _One_then_variadic_args_t{},
+            _STD move(_Right._Getal())) {
+        _Get_scary()->_Take_contents(*_Right._Get_scary());
+    }
+
+    _Node_hash(_Node_hash&& _Right, const allocator_type& _Al)
+        : _Mypair(_One_then_variadic_args_t{}, _Right._Mypair._Get_first(), _One_then_variadic_args_t{}, _Al) {
+        if constexpr (_Alnode_traits::is_always_equal::value) {
+            _Get_scary()->_Take_contents(*_Right._Get_scary());
+        } else {
+            if (_Getal() == _Right._Getal()) {
+                _Get_scary()->_Take_contents(*_Right._Get_scary());
+            } else {
+                _Move_from(_Right);
+            }
+        }
+    }
+
+    _Node_hash& operator=(const _Node_hash& _Right) {
+        if (this != _STD addressof(_Right)) {
+            _Tidy();
+            _Pocca(_Getal(), _Right._Getal());
+            _Mypair._Get_first() = _Right._Mypair._Get_first();
+            _Copy_from(_Right);
+        }
+
+        return *this;
+    }
+
+    _Node_hash& operator=(_Node_hash&& _Right) noexcept(
+        _Alnode_traits::is_always_equal::value && is_nothrow_move_assignable_v<_Key_compare>) {
+        if (this != _STD addressof(_Right)) {
+            _Tidy();
+            _Mypair._Get_first() = _STD move(_Right._Mypair._Get_first());
+            constexpr auto _Pocma_val = _Choose_pocma_v<_Alnode>;
+            if constexpr (_Pocma_val == _Pocma_values::_No_propagate_allocators) {
+                if (_Getal() != _Right._Getal()) {
+                    _Move_from(_Right);
+                    return *this;
+                }
+            }
+
+            _Pocma(_Getal(), _Right._Getal());
+            _Get_scary()->_Take_contents(*_Right._Get_scary());
+        }
+
+        return *this;
+    }
+
+public:
+    ~_Node_hash() noexcept {
+        _Tidy();
+    }
+
+    void swap(_Node_hash& _Right) noexcept(_Is_nothrow_swappable<_Key_compare>::value) /* strengthened */ {
+        if (this != _STD addressof(_Right)) {
+            _Pocs(_Getal(), _Right._Getal());
+            _Get_scary()->_Swap_val(*_Right._Get_scary());
+            _Mypair._Get_first().swap(_Right._Mypair._Get_first());
+        }
+    }
+
+    _NODISCARD allocator_type get_allocator() const noexcept {
+        return static_cast<allocator_type>(_Getal());
+    }
+
+    _NODISCARD iterator begin() noexcept {
+        return iterator{_Get_scary()->_Before_begin._Next};
+    }
+
+    _NODISCARD const_iterator begin() const noexcept {
+        return const_iterator{_Get_scary()->_Before_begin._Next};
+    }
+
+    _NODISCARD iterator end() noexcept {
+        return iterator{};
+    }
+
+    _NODISCARD const_iterator end() const noexcept {
+        return const_iterator{};
+    }
+
+    _NODISCARD const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    _NODISCARD const_iterator cend() const noexcept {
+        return end();
+    }
+
+    _NODISCARD_EMPTY_MEMBER bool empty() const noexcept {
+        return _Get_scary()->_Size == 0;
+    }
+
+    _NODISCARD size_type size() const noexcept {
+        return _Get_scary()->_Size;
+    }
+
+    _NODISCARD size_type max_size() const noexcept {
+        return (_STD min)(static_cast<size_type>(_Alnode_traits::max_size(_Getal())),
+            static_cast<size_type>((numeric_limits<difference_type>::max)()));
+    }
+
+    _NODISCARD size_type bucket_count() const noexcept {
+        return _Get_scary()->_Bucket_count;
+    }
+
+    _NODISCARD size_type max_bucket_count() const noexcept { // the largest power of 2 the bucket array can hold
+        const _Albucket _Alb(_Getal());
+        const size_type _Max_storage = (_STD min)(static_cast<size_type>(_Albucket_traits::max_size(_Alb)),
+            static_cast<size_type>((numeric_limits<difference_type>::max)()) / sizeof(_Link*));
+        return static_cast<size_type>(1) << _Floor_of_log_2(_Max_storage);
+    }
+
+    _NODISCARD size_type bucket(const key_type& _Keyval) const
+        noexcept(_Nothrow_hash<_Traits, key_type>) /* strengthened */ {
+        _STL_ASSERT(bucket_count() != 0, "bucket() requires a non-empty bucket array");
+        return _Get_scary()->_Bucket_of(_Traitsobj()(_Keyval));
+    }
+
+    _NODISCARD size_type bucket_size(const size_type _Bucket) const noexcept /* strengthened */ {
+        const auto _Scary = _Get_scary();
+        _STL_ASSERT(_Bucket < _Scary->_Bucket_count, "bucket index out of range");
+        size_type _Count = 0;
+        if (const _Link* const _Before = _Scary->_Buckets[_Bucket]) {
+            for (const _Node* _Pnode = _Before->_Next; _Pnode; _Pnode = _Pnode->_Next) {
+                if (_Scary->_Bucket_of(_Pnode->_Hashval) != _Bucket) { // the elements of the next bucket begin here
+                    break;
+                }
+
+                ++_Count;
+            }
+        }
+
+        return _Count;
+    }
+
+    _NODISCARD float load_factor() const noexcept {
+        const size_type _Buckets = bucket_count();
+        return _Buckets == 0 ? 0.0f : static_cast<float>(size()) / static_cast<float>(_Buckets);
+    }
+
+    _NODISCARD float max_load_factor() const noexcept {
+        return _Max_bucket_size();
+    }
+
+    void max_load_factor(float _Newmax) noexcept /* strengthened */ {
+        _STL_ASSERT(!(_CSTD isnan)(_Newmax) && _Newmax > 0, "invalid hash load factor");
+        _Max_bucket_size() = _Newmax;
+    }
+
+    void rehash(size_type _Buckets) { // rebuild the table with at least _Buckets buckets, keeping the load in bounds
+        _Buckets = (_STD max)(_Buckets, _Min_load_factor_buckets(size()));
+        if (_Buckets == 0 && empty()) {
+            _Tidy();
+            return;
+        }
+
+        const size_type _New_count = _Bucket_count_for(_Buckets);
+        if (_New_count != bucket_count()) {
+            _Rehash(_New_count);
+        }
+    }
+
+    void reserve(const size_type _Count) { // ensure that _Count elements fit without further rehashing
+        const size_type _Buckets = _Min_load_factor_buckets(_Count);
+        if (_Buckets > bucket_count()) {
+            _Rehash(_Bucket_count_for(_Buckets));
+        }
+    }
+
+    void clear() noexcept { // erase all elements, keeping the bucket array
+        const auto _Scary = _Get_scary();
+        if (_Scary->_Size == 0) {
+            return;
+        }
+
+        _Free_nodes();
+        for (size_type _Idx = 0; _Idx < _Scary->_Bucket_count; ++_Idx) {
+            _Scary->_Buckets[_Idx] = nullptr;
+        }
+    }
+
+    template <class... _Valtys>
+    pair<iterator, bool> emplace(_Valtys&&... _Vals) {
+        using _In_place_key_extractor = typename _Traits::template _In_place_key_extractor<_Remove_cvref_t<_Valtys>...>;
+        if constexpr (_In_place_key_extractor::_Extractable) {
+            const auto& _Keyval = _In_place_key_extractor::_Extract(_Vals...);
+            return _Emplace_key(_Keyval, _STD forward<_Valtys>(_Vals)...);
+        } else {
+            _Node* const _Pnode = _Buynode(_STD forward<_Valtys>(_Vals)...);
+            _Node* _Existing;
+            _TRY_BEGIN
+            const auto& _Keyval = _Traits::_Kfn(_Pnode->_Myval);
+            _Pnode->_Hashval    = _Traitsobj()(_Keyval);
+            _Existing           = _Find_node(_Keyval, _Pnode->_Hashval);
+            if (!_Existing) {
+                _Reserve_for_insert(1);
+            }
+            _CATCH_ALL
+            _Freenode(_Pnode);
+            _RERAISE;
+            _CATCH_END
+
+            if (_Existing) {
+                _Freenode(_Pnode);
+                return {iterator{_Existing}, false};
+            }
+
+            _Link_node(_Pnode);
+            return {iterator{_Pnode}, true};
+        }
+    }
+
+    template <class... _Valtys>
+    iterator emplace_hint(const_iterator, _Valtys&&... _Vals) { // the hint does not help a hash table
+        return emplace(_STD forward<_Valtys>(_Vals)...).first;
+    }
+
+    pair<iterator, bool> insert(const value_type& _Val) {
+        return _Emplace_key(_Traits::_Kfn(_Val), _Val);
+    }
+
+    pair<iterator, bool> insert(value_type&& _Val) {
+        return _Emplace_key(_Traits::_Kfn(_Val), _STD move(_Val));
+    }
+
+    iterator insert(const_iterator, const value_type& _Val) {
+        return insert(_Val).first;
+    }
+
+    iterator insert(const_iterator, value_type&& _Val) {
+        return insert(_STD move(_Val)).first;
+    }
+
+    template <class _Iter>
+    void insert(_Iter _First, _Iter _Last) {
+        _Adl_verify_range(_First, _Last);
+        auto _UFirst      = _Get_unwrapped(_First);
+        const auto _ULast = _Get_unwrapped(_Last);
+        if constexpr (_Is_ranges_fwd_iter_v<decltype(_UFirst)>) {
+            _Reserve_for_insert(static_cast<size_type>(_STD distance(_UFirst, _ULast)));
+        }
+
+        _Insert_range_unchecked(_UFirst, _ULast);
+    }
+
+    void insert(initializer_list<value_type> _Ilist) {
+        insert(_Ilist.begin(), _Ilist.end());
+    }
+
+#if _HAS_CXX20 && defined(__cpp_lib_concepts) // TRANSITION, GH-395
+    template <_RANGES input_range _Rng>
+    void insert_range(_Rng&& _Range) { // insert a whole range, rehashing at most once when its size is known
+        if constexpr (_RANGES sized_range<_Rng> || _RANGES forward_range<_Rng>) {
+            _Reserve_for_insert(static_cast<size_type>(_RANGES distance(_Range)));
+        }
+
+        _Insert_range_unchecked(_RANGES _Ubegin(_Range), _RANGES _Uend(_Range));
+    }
+#else // ^^^ _HAS_CXX20 && defined(__cpp_lib_concepts) / !_HAS_CXX20 || !defined(__cpp_lib_concepts) vvv
+    template <class _Rng>
+    void insert_range(_Rng&& _Range) { // insert a whole range, rehashing at most once when its size is known
+        insert(_STD begin(_Range), _STD end(_Range));
+    }
+#endif // ^^^ !_HAS_CXX20 || !defined(__cpp_lib_concepts) ^^^
+
+    iterator erase(const_iterator _Where) noexcept /* strengthened */ {
+        return iterator{_Erase_node(_Where._Ptr)};
+    }
+
+    template <class _Iter = iterator, enable_if_t<!is_same_v<_Iter, const_iterator>, int> = 0>
+    iterator erase(iterator _Where) noexcept /* strengthened */ {
+        return erase(const_iterator{_Where});
+    }
+
+    iterator erase(const_iterator _First, const const_iterator _Last) noexcept /* strengthened */ {
+        while (_First != _Last) {
+            _First = erase(_First);
+        }
+
+        return iterator{_Last._Ptr};
+    }
+
+    size_type erase(const key_type& _Keyval) noexcept(
+        _Nothrow_hash<_Traits, key_type> && _Nothrow_compare<_Traits, key_type, key_type>) /* strengthened */ {
+        _Node* const _Pnode = _Find_node(_Keyval, _Traitsobj()(_Keyval));
+        if (!_Pnode) {
+            return 0;
+        }
+
+        _Erase_node(_Pnode);
+        return 1;
+    }
+
+    template <class _Keyty = void>
+    _NODISCARD iterator find(typename _Traits::template _Deduce_key<_Keyty> _Keyval) {
+        return iterator{_Find_node(_Keyval, _Traitsobj()(_Keyval))};
+    }
+
+    template <class _Keyty = void>
+    _NODISCARD const_iterator find(typename _Traits::template _Deduce_key<_Keyty> _Keyval) const {
+        return const_iterator{_Find_node(_Keyval, _Traitsobj()(_Keyval))};
+    }
+
+    template <class _Keyty = void>
+    _NODISCARD bool contains(typename _Traits::template _Deduce_key<_Keyty> _Keyval) const {
+        return _Find_node(_Keyval, _Traitsobj()(_Keyval)) != nullptr;
+    }
+
+    template <class _Keyty = void>
+    _NODISCARD size_type count(typename _Traits::template _Deduce_key<_Keyty> _Keyval) const {
+        return contains<_Keyty>(_Keyval);
+    }
+
+protected:
+    template <class _Keyty>
+    _NODISCARD _Node* _Find_node(const _Keyty& _Keyval, const size_t _Hashval) const {
+        // returns the element equivalent to _Keyval, or nullptr if there is none
+        const auto _Scary = _Get_scary();
+        if (_Scary->_Size == 0) {
+            return nullptr;
+        }
+
+        const size_type _Bucket    = _Scary->_Bucket_of(_Hashval);
+        const _Link* const _Before = _Scary->_Buckets[_Bucket];
+        if (!_Before) {
+            return nullptr;
+        }
+
+        for (_Node* _Pnode = _Before->_Next; _Pnode; _Pnode = _Pnode->_Next) {
+            if (_Pnode->_Hashval == _Hashval) { // only compare keys whose full hashes match
+                if (!_Traitsobj()(_Keyval, _Traits::_Kfn(_Pnode->_Myval))) {
+                    return _Pnode;
+                }
+            } else if (_Scary->_Bucket_of(_Pnode->_Hashval) != _Bucket) { // the elements of the next bucket begin here
+                break;
+            }
+        }
+
+        return nullptr;
+    }
+
+    template <class _Keyty, class... _Valtys>
+    pair<iterator, bool> _Emplace_key(const _Keyty& _Keyval, _Valtys&&... _Vals) {
+        // insert a value constructed from _Vals... unless an element equivalent to _Keyval is present
+        const size_t _Hashval = _Traitsobj()(_Keyval);
+        if (_Node* const _Existing = _Find_node(_Keyval, _Hashval)) {
+            return {iterator{_Existing}, false};
+        }
+
+        // rehashing relinks the nodes without moving any value, so _Vals stay valid even if they refer to elements
+        _Reserve_for_insert(1);
+        _Node* const _Pnode = _Buynode(_STD forward<_Valtys>(_Vals)...);
+        _Pnode->_Hashval    = _Hashval;
+        _Link_node(_Pnode);
+        return {iterator{_Pnode}, true};
+    }
+
+    template <class _Iter, class _Sent>
+    void _Insert_range_unchecked(_Iter _First, const _Sent _Last) {
+        for (; _First != _Last; ++_First) {
+            emplace(*_First);
+        }
+    }
+
+    void _Reserve_for_insert(const size_type _Count) {
+        const auto _Scary        = _Get_scary();
+        const size_type _Newsize = _Scary->_Size + _Count;
+        if (_Scary->_Bucket_count == 0
+            || max_load_factor() < static_cast<float>(_Newsize) / static_cast<float>(_Scary->_Bucket_count)) {
+            _Rehash(_Bucket_count_for((_STD max)(_Scary->_Bucket_count * 2, _Min_load_factor_buckets(_Newsize))));
+        }
+    }
+
+    void _Link_node(_Node* const _Pnode) noexcept {
+        // link a node whose hash is cached at the front of its bucket; assumes the bucket array exists
+        const auto _Scary = _Get_scary();
+        _Link*& _Before   = _Scary->_Buckets[_Scary->_Bucket_of(_Pnode->_Hashval)];
+        if (_Before) {
+            _Pnode->_Next  = _Before->_Next;
+            _Before->_Next = _Pnode;
+        } else { // the bucket was empty, so it starts at the front of the list
+            _Pnode->_Next               = _Scary->_Before_begin._Next;
+            _Scary->_Before_begin._Next = _Pnode;
+            if (_Pnode->_Next) { // the bucket previously at the front now follows _Pnode
+                _Scary->_Buckets[_Scary->_Bucket_of(_Pnode->_Next->_Hashval)] = _Pnode;
+            }
+
+            _Before = &_Scary->_Before_begin;
+        }
+
+        ++_Scary->_Size;
+    }
+
+    _Node* _Erase_node(_Node* const _Pnode) noexcept { // unlink and free _Pnode, returning its successor
+        const auto _Scary       = _Get_scary();
+        const size_type _Bucket = _Scary->_Bucket_of(_Pnode->_Hashval);
+        _Link* const _Before    = _Scary->_Buckets[_Bucket];
+        _Link* _Prev            = _Before;
+        while (_Prev->_Next != _Pnode) {
+            _Prev = _Prev->_Next;
+        }
+
+        _Node* const _Next     = _Pnode->_Next;
+        const bool _Bucket_end = !_Next || _Scary->_Bucket_of(_Next->_Hashval) != _Bucket;
+        if (_Bucket_end) {
+            if (_Next) { // the following bucket is now preceded by _Prev
+                _Scary->_Buckets[_Scary->_Bucket_of(_Next->_Hashval)] = _Prev;
+            }
+
+            if (_Prev == _Before) { // _Pnode was the only element of its bucket
+                _Scary->_Buckets[_Bucket] = nullptr;
+            }
+        }
+
+        _Prev->_Next = _Next;
+        _Freenode(_Pnode);
+        --_Scary->_Size;
+        return _Next;
+    }
+
+    _NODISCARD size_type _Min_load_factor_buckets(const size_type _For_size) const noexcept {
+        // returns the minimum number of buckets necessary for _For_size elements
+        return static_cast<size_type>(_CSTD ceilf(static_cast<float>(_For_size) / max_load_factor()));
+    }
+
+    _NODISCARD size_type _Bucket_count_for(const size_type _Buckets) const {
+        // returns the smallest power of 2 that is no less than _Buckets and _Min_buckets
+        if (_Buckets > max_bucket_count()) {
+            _Xlength_error("node_hash too long");
+        }
+
+        if (_Buckets <= _Min_buckets) {
+            return _Min_buckets;
+        }
+
+        return static_cast<size_type>(1) << _Ceiling_of_log_2(_Buckets);
+    }
+
+    void _Rehash(const size_type _New_count) { // relink every node into a new array of _New_count buckets
+        const auto _Scary = _Get_scary();
+        _Albucket _Alb(_Getal());
+        _Link** const _New_buckets = _Unfancy(_Albucket_traits::allocate(_Alb, _New_count));
+        for (size_type _Idx = 0; _Idx < _New_count; ++_Idx) {
+            _New_buckets[_Idx] = nullptr;
+        }
+
+        // nothing below can throw: the cached hashes place every node without calling the hasher
+        const size_type _New_mask = _New_count - 1;
+        size_type _Front_bucket   = 0; // the bucket of the element at the front of the new list
+        _Node* _Pnode             = _STD exchange(_Scary->_Before_begin._Next, nullptr);
+        while (_Pnode) {
+            _Node* const _Next      = _Pnode->_Next;
+            const size_type _Bucket = _Pnode->_Hashval & _New_mask;
+            if (_New_buckets[_Bucket]) {
+                _Pnode->_Next                = _New_buckets[_Bucket]->_Next;
+                _New_buckets[_Bucket]->_Next = _Pnode;
+            } else {
+                _Pnode->_Next               = _Scary->_Before_begin._Next;
+                _Scary->_Before_begin._Next = _Pnode;
+                _New_buckets[_Bucket]       = &_Scary->_Before_begin;
+                if (_Pnode->_Next) {
+                    _New_buckets[_Front_bucket] = _Pnode;
+                }
+
+                _Front_bucket = _Bucket;
+            }
+
+            _Pnode = _Next;
+        }
+
+        _Free_buckets();
+        _Scary->_Buckets      = _New_buckets;
+        _Scary->_Bucket_count = _New_count;
+    }
+
+    template <class... _Valtys>
+    _NODISCARD _Node* _Buynode(_Valtys&&... _Vals) { // allocate an unlinked node holding a value built from _Vals...
+        _Alnode& _Al        = _Getal();
+        _Node* const _Pnode = _Unfancy(_Alnode_traits::allocate(_Al, 1));
+        _TRY_BEGIN
+        _Alnode_traits::construct(_Al, _STD addressof(_Pnode->_Myval), _STD forward<_Valtys>(_Vals)...);
+        _CATCH_ALL
+        _Alnode_traits::deallocate(_Al, _Refancy<typename _Alnode_traits::pointer>(_Pnode), 1);
+        _RERAISE;
+        _CATCH_END
+
+        _Pnode->_Next    = nullptr;
+        _Pnode->_Hashval = 0;
+        return _Pnode;
+    }
+
+    void _Freenode(_Node* const _Pnode) noexcept {
+        _Alnode& _Al = _Getal();
+        _Alnode_traits::destroy(_Al, _STD addressof(_Pnode->_Myval));
+        _Alnode_traits::deallocate(_Al, _Refancy<typename _Alnode_traits::pointer>(_Pnode), 1);
+    }
+
+    template <class _Valty>
+    void _Append_copies(const _Node_hash& _Right, _Valty _Value_of) {
+        // Give this empty table the bucket count of _Right and append a copy of every element in _Right's order; as the
+        // hashes and bucket count are the same, the elements of each bucket stay adjacent.
+        const auto _Scary       = _Get_scary();
+        const auto _Right_scary = _Right._Get_scary();
+        if (_Right_scary->_Size == 0) {
+            return;
+        }
+
+        _Rehash(_Right_scary->_Bucket_count);
+        _TRY_BEGIN
+        _Link* _Tail = &_Scary->_Before_begin;
+        for (_Node* _Source = _Right_scary->_Before_begin._Next; _Source; _Source = _Source->_Next) {
+            _Node* const _Pnode = _Buynode(_Value_of(_Source->_Myval));
+            _Pnode->_Hashval    = _Source->_Hashval;
+            _Link*& _Before     = _Scary->_Buckets[_Scary->_Bucket_of(_Pnode->_Hashval)];
+            if (!_Before) {
+                _Before = _Tail;
+            }
+
+            _Tail->_Next = _Pnode;
+            _Tail        = _Pnode;
+            ++_Scary->_Size;
+        }
+        _CATCH_ALL
+        _Tidy();
+        _RERAISE;
+        _CATCH_END
+    }
+
+    void _Copy_from(const _Node_hash& _Right) {
+        _Append_copies(_Right, [](const value_type& _Val) -> const value_type& { return _Val; });
+    }
+
+    void _Move_from(_Node_hash& _Right) { // move elements one at a time, for allocators that cannot be stolen from
+        _Append_copies(_Right, [](value_type& _Val) -> _Mutable_value_type&& {
+            return _STD move(reinterpret_cast<_Mutable_value_type&>(_Val));
+        });
+    }
+
+    void _Free_nodes() noexcept { // free every element, leaving the bucket array alone
+        const auto _Scary = _Get_scary();
+        _Node* _Pnode     = _STD exchange(_Scary->_Before_begin._Next, nullptr);
+        while (_Pnode) {
+            _Node* const _Next = _Pnode->_Next;
+            _Freenode(_Pnode);
+            _Pnode = _Next;
+        }
+
+        _Scary->_Size = 0;
+    }
+
+    void _Free_buckets() noexcept {
+        const auto _Scary = _Get_scary();
+        if (_Scary->_Bucket_count != 0) {
+            _Albucket _Alb(_Getal());
+            _Albucket_traits::deallocate(
+                _Alb, _Refancy<typename _Albucket_traits::pointer>(_Scary->_Buckets), _Scary->_Bucket_count);
+            _Scary->_Buckets      = nullptr;
+            _Scary->_Bucket_count = 0;
+        }
+    }
+
+    void _Tidy() noexcept { // destroy all elements and free storage
+        _Free_nodes();
+        _Free_buckets();
+    }
+
+    _NODISCARD float& _Max_bucket_size() noexcept {
+        return _Traitsobj()._Get_max_bucket_size();
+    }
+
+    _NODISCARD const float& _Max_bucket_size() const noexcept {
+        return _Traitsobj()._Get_max_bucket_size();
+    }
+
+    _NODISCARD _Traits& _Traitsobj() noexcept {
+        return _Mypair._Get_first();
+    }
+
+    _NODISCARD const _Traits& _Traitsobj() const noexcept {
+        return _Mypair._Get_first();
+    }
+
+    _NODISCARD _Alnode& _Getal() noexcept {
+        return _Mypair._Myval2._Get_first();
+    }
+
+    _NODISCARD const _Alnode& _Getal() const noexcept {
+        return _Mypair._Myval2._Get_first();
+    }
+
+    _NODISCARD _Scary_val* _Get_scary() noexcept {
+        return _STD addressof(_Mypair._Myval2._Myval2);
+    }
+
+    _NODISCARD const _Scary_val* _Get_scary() const noexcept {
+        return _STD addressof(_Mypair._Myval2._Myval2);
+    }
+
+    _Compressed_pair<_Traits, _Compressed_pair<_Alnode, _Scary_val>> _Mypair;
+};
+_STD_END
+
+#pragma pop_macro("new")
+_STL_RESTORE_CLANG_WARNINGS
+#pragma warning(pop)
+#pragma pack(pop)
+#endif // ^^^ _HAS_CXX17 ^^^
+
+#endif // _STL_COMPILER_PREPROCESSOR
+#endif // __MSVC_NODE_HASH_HPP
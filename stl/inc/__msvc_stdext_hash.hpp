@@ -0,0 +1,324 @@
+// __msvc_stdext_hash.hpp internal header
+
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef __MSVC_STDEXT_HASH_HPP
+#define __MSVC_STDEXT_HASH_HPP
+#include <yvals_core.h>
+#if _STL_COMPILER_PREPROCESSOR
+
+#if !_HAS_CXX17
+_EMIT_STL_WARNING(STL4038, "The contents of <__msvc_stdext_hash.hpp> are available only with C++17 or later.");
+#else // ^^^ !_HAS_CXX17 / _HAS_CXX17 vvv
+#include <xhash>
+
+#pragma pack(push, _CRT_PACKING)
+#pragma warning(push, _STL_WARNING_LEVEL)
+#pragma warning(disable : _STL_DISABLED_WARNINGS)
+_STL_DISABLE_CLANG_WARNINGS
+#pragma push_macro("new")
+#undef new
+
+// The stdext hash containers (flat_hash_map, flat_hash_set, node_hash_map and node_hash_set) differ only in their
+// table, _STD _Flat_hash or _STD _Node_hash; everything they add on top of the table is defined once, here.
+namespace stdext {
+    template <class _Kty, // key type
+        class _Ty, // mapped type
+        class _Hasher, // hash function type
+        class _Keyeq, // equality predicate type
+        class _Alloc> // actual allocator type (should be value allocator)
+    class _Hash_map_traits : public _STD _Uhash_compare<_Kty, _Hasher, _Keyeq> {
+        // traits required to make a hash table behave like a map
+    public:
+        using key_type            = _Kty;
+        using mapped_type         = _Ty;
+        using value_type          = _STD pair<const _Kty, _Ty>;
+        using _Mutable_value_type = _STD pair<_Kty, _Ty>;
+        using hasher              = _Hasher;
+        using key_equal           = _Keyeq;
+        using key_compare         = _STD _Uhash_compare<_Kty, _Hasher, _Keyeq>;
+        using allocator_type      = _Alloc;
+
+        template <class... _Args>
+        using _In_place_key_extractor = _STD _In_place_key_extract_map<_Kty, _Args...>;
+
+        _Hash_map_traits() = default;
+
+        explicit _Hash_map_traits(const key_compare& _Traits) noexcept(
+            _STD is_nothrow_copy_constructible_v<key_compare>)
+            : key_compare(_Traits) {}
+
+        template <class _Ty1, class _Ty2>
+        static const _Kty& _Kfn(const _STD pair<_Ty1, _Ty2>& _Val) noexcept { // extract key from element value
+            return _Val.first;
+        }
+    };
+
+    template <class _Kty, // key/value type
+        class _Hasher, // hash function type
+        class _Keyeq, // equality predicate type
+        class _Alloc> // actual allocator type (should be value allocator)
+    class _Hash_set_traits : public _STD _Uhash_compare<_Kty, _Hasher, _Keyeq> {
+        // traits required to make a hash table behave like a set
+    public:
+        using key_type            = _Kty;
+        using value_type          = _Kty;
+        using _Mutable_value_type = _Kty;
+        using hasher              = _Hasher;
+        using key_equal           = _Keyeq;
+        using key_compare         = _STD _Uhash_compare<_Kty, _Hasher, _Keyeq>;
+        using allocator_type      = _Alloc;
+
+        template <class... _Args>
+        using _In_place_key_extractor = _STD _In_place_key_extract_set<_Kty, _Args...>;
+
+        _Hash_set_traits() = default;
+
+        explicit _Hash_set_traits(const key_compare& _Traits) noexcept(
+            _STD is_nothrow_copy_constructible_v<key_compare>)
+            : key_compare(_Traits) {}
+
+        static const _Kty& _Kfn(const value_type& _Val) noexcept {
+            return _Val;
+        }
+    };
+
+    template <template <class> class _Table, // _STD _Flat_hash or _STD _Node_hash
+        class _Traits> // _Hash_map_traits or _Hash_set_traits
+    class _Hash_container : public _Table<_Traits> { // constructors and comparisons of a stdext hash container
+    private:
+        using _Mybase       = _Table<_Traits>;
+        using _Key_compare  = typename _Traits::key_compare;
+        using _Alty_traits  = typename _Mybase::_Alty_traits;
+        using _Alloc_traits = _STD allocator_traits<typename _Traits::allocator_type>;
+
+    public:
+        using hasher    = typename _Traits::hasher;
+        using key_equal = typename _Traits::key_equal;
+
+        using value_type     = typename _Mybase::value_type;
+        using allocator_type = typename _Mybase::allocator_type;
+        using size_type      = typename _Mybase::size_type;
+
+        _Hash_container() : _Mybase(_Key_compare(), allocator_type()) {}
+
+        explicit _Hash_container(const allocator_type& _Al) : _Mybase(_Key_compare(), _Al) {}
+
+        _Hash_container(const _Hash_container& _Right)
+            : _Mybase(_Right, _Alloc_traits::select_on_container_copy_construction(_Right.get_allocator())) {}
+
+        _Hash_container(const _Hash_container& _Right, const allocator_type& _Al) : _Mybase(_Right, _Al) {}
+
+        // _Count means what it means to rehash(): elements that fit in a flat table, buckets in a node table
+        explicit _Hash_container(size_type _Count, const hasher& _Hasharg = hasher(),
+            const key_equal& _Keyeqarg = key_equal(), const allocator_type& _Al = allocator_type())
+            : _Mybase(_Key_compare(_Hasharg, _Keyeqarg), _Al) {
+            _Mybase::rehash(_Count);
+        }
+
+        _Hash_container(size_type _Count, const allocator_type& _Al) : _Mybase(_Key_compare(), _Al) {
+            _Mybase::rehash(_Count);
+        }
+
+        _Hash_container(size_type _Count, const hasher& _Hasharg, const allocator_type& _Al)
+            : _Mybase(_Key_compare(_Hasharg), _Al) {
+            _Mybase::rehash(_Count);
+        }
+
+        template <class _Iter>
+        _Hash_container(_Iter _First, _Iter _Last, size_type _Count = 0, const hasher& _Hasharg = hasher(),
+            const key_equal& _Keyeqarg = key_equal(), const allocator_type& _Al = allocator_type())
+            : _Mybase(_Key_compare(_Hasharg, _Keyeqarg), _Al) {
+            _Mybase::rehash(_Count);
+            _Mybase::insert(_First, _Last);
+        }
+
+        _Hash_container(_STD initializer_list<value_type> _Ilist, size_type _Count = 0,
+            const hasher& _Hasharg = hasher(), const key_equal& _Keyeqarg = key_equal(),
+            const allocator_type& _Al = allocator_type())
+            : _Mybase(_Key_compare(_Hasharg, _Keyeqarg), _Al) {
+            _Mybase::rehash(_Count);
+            _Mybase::insert(_Ilist);
+        }
+
+        _Hash_container(_Hash_container&& _Right) : _Mybase(_STD move(_Right)) {}
+
+        _Hash_container(_Hash_container&& _Right, const allocator_type& _Al) : _Mybase(_STD move(_Right), _Al) {}
+
+        _Hash_container& operator=(const _Hash_container& _Right) {
+            _Mybase::operator=(_Right);
+            return *this;
+        }
+
+        _Hash_container& operator=(_Hash_container&& _Right) noexcept(
+            _Alty_traits::is_always_equal::value && _STD is_nothrow_move_assignable_v<_Key_compare>) {
+            _Mybase::operator=(_STD move(_Right));
+            return *this;
+        }
+
+        _Hash_container& operator=(_STD initializer_list<value_type> _Ilist) {
+            _Mybase::clear();
+            _Mybase::insert(_Ilist);
+            return *this;
+        }
+
+        _NODISCARD hasher hash_function() const {
+            return this->_Traitsobj()._Mypair._Get_first();
+        }
+
+        _NODISCARD key_equal key_eq() const {
+            return this->_Traitsobj()._Mypair._Myval2._Get_first();
+        }
+
+        _NODISCARD friend bool operator==(const _Hash_container& _Left, const _Hash_container& _Right) {
+            if (_Left.size() != _Right.size()) {
+                return false;
+            }
+
+            const auto _Right_end = _Right.end();
+            for (const auto& _Val : _Left) {
+                const auto _Where = _Right.find(_Traits::_Kfn(_Val));
+                if (_Where == _Right_end || !(*_Where == _Val)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+#if !_HAS_CXX20
+        _NODISCARD friend bool operator!=(const _Hash_container& _Left, const _Hash_container& _Right) {
+            return !(_Left == _Right);
+        }
+#endif // !_HAS_CXX20
+    };
+
+    template <template <class> class _Table, class _Traits>
+    class _Hash_map_container : public _Hash_container<_Table, _Traits> { // lookup and insertion by key of a map
+    private:
+        using _Mybase = _Hash_container<_Table, _Traits>;
+
+    public:
+        using key_type       = typename _Traits::key_type;
+        using mapped_type    = typename _Traits::mapped_type;
+        using value_type     = typename _Traits::value_type;
+        using iterator       = typename _Mybase::iterator;
+        using const_iterator = typename _Mybase::const_iterator;
+
+        using _Mybase::_Mybase;
+        using _Mybase::operator=;
+
+        using _Mybase::insert;
+
+        template <class _Valty, _STD enable_if_t<_STD is_constructible_v<value_type, _Valty>, int> = 0>
+        _STD pair<iterator, bool> insert(_Valty&& _Val) {
+            return this->emplace(_STD forward<_Valty>(_Val));
+        }
+
+        template <class _Valty, _STD enable_if_t<_STD is_constructible_v<value_type, _Valty>, int> = 0>
+        iterator insert(const_iterator, _Valty&& _Val) {
+            return this->emplace(_STD forward<_Valty>(_Val)).first;
+        }
+
+    private:
+        template <class _Keyty, class... _Mappedty>
+        _STD pair<iterator, bool> _Try_emplace(_Keyty&& _Keyval, _Mappedty&&... _Mapval) {
+            return this->_Emplace_key(_Keyval, _STD piecewise_construct,
+                _STD forward_as_tuple(_STD forward<_Keyty>(_Keyval)),
+                _STD forward_as_tuple(_STD forward<_Mappedty>(_Mapval)...));
+        }
+
+        template <class _Keyty, class _Mappedty>
+        _STD pair<iterator, bool> _Insert_or_assign(_Keyty&& _Keyval, _Mappedty&& _Mapval) {
+            const auto _Result = _Try_emplace(_STD forward<_Keyty>(_Keyval), _STD forward<_Mappedty>(_Mapval));
+            if (!_Result.second) {
+                _Result.first->second = _STD forward<_Mappedty>(_Mapval);
+            }
+
+            return _Result;
+        }
+
+    public:
+        template <class... _Mappedty>
+        _STD pair<iterator, bool> try_emplace(const key_type& _Keyval, _Mappedty&&... _Mapval) {
+            return _Try_emplace(_Keyval, _STD forward<_Mappedty>(_Mapval)...);
+        }
+
+        template <class... _Mappedty>
+        _STD pair<iterator, bool> try_emplace(key_type&& _Keyval, _Mappedty&&... _Mapval) {
+            return _Try_emplace(_STD move(_Keyval), _STD forward<_Mappedty>(_Mapval)...);
+        }
+
+        template <class... _Mappedty>
+        iterator try_emplace(const const_iterator, const key_type& _Keyval, _Mappedty&&... _Mapval) {
+            return _Try_emplace(_Keyval, _STD forward<_Mappedty>(_Mapval)...).first;
+        }
+
+        template <class... _Mappedty>
+        iterator try_emplace(const const_iterator, key_type&& _Keyval, _Mappedty&&... _Mapval) {
+            return _Try_emplace(_STD move(_Keyval), _STD forward<_Mappedty>(_Mapval)...).first;
+        }
+
+        template <class _Mappedty>
+        _STD pair<iterator, bool> insert_or_assign(const key_type& _Keyval, _Mappedty&& _Mapval) {
+            return _Insert_or_assign(_Keyval, _STD forward<_Mappedty>(_Mapval));
+        }
+
+        template <class _Mappedty>
+        _STD pair<iterator, bool> insert_or_assign(key_type&& _Keyval, _Mappedty&& _Mapval) {
+            return _Insert_or_assign(_STD move(_Keyval), _STD forward<_Mappedty>(_Mapval));
+        }
+
+        template <class _Mappedty>
+        iterator insert_or_assign(const_iterator, const key_type& _Keyval, _Mappedty&& _Mapval) {
+            return _Insert_or_assign(_Keyval, _STD forward<_Mappedty>(_Mapval)).first;
+        }
+
+        template <class _Mappedty>
+        iterator insert_or_assign(const_iterator, key_type&& _Keyval, _Mappedty&& _Mapval) {
+            return _Insert_or_assign(_STD move(_Keyval), _STD forward<_Mappedty>(_Mapval)).first;
+        }
+
+        mapped_type& operator[](key_type&& _Keyval) {
+            return _Try_emplace(_STD move(_Keyval)).first->second;
+        }
+
+        mapped_type& operator[](const key_type& _Keyval) {
+            return _Try_emplace(_Keyval).first->second;
+        }
+
+        _NODISCARD mapped_type& at(const key_type& _Keyval) {
+            const auto _Where = this->find(_Keyval);
+            if (_Where == this->end()) {
+                _STD _Xout_of_range("invalid hash map<K, T> key");
+            }
+
+            return _Where->second;
+        }
+
+        _NODISCARD const mapped_type& at(const key_type& _Keyval) const {
+            const auto _Where = this->find(_Keyval);
+            if (_Where == this->end()) {
+                _STD _Xout_of_range("invalid hash map<K, T> key");
+            }
+
+            return _Where->second;
+        }
+    };
+
+    template <template <class> class _Table, class _Traits, class _Pr>
+    typename _Hash_container<_Table, _Traits>::size_type erase_if(
+        _Hash_container<_Table, _Traits>& _Cont, _Pr _Pred) {
+        return _STD _Erase_nodes_if(_Cont, _STD _Pass_fn(_Pred));
+    }
+} // namespace stdext
+
+#pragma pop_macro("new")
+_STL_RESTORE_CLANG_WARNINGS
+#pragma warning(pop)
+#pragma pack(pop)
+#endif // ^^^ _HAS_CXX17 ^^^
+
+#endif // _STL_COMPILER_PREPROCESSOR
+#endif // __MSVC_STDEXT_HASH_HPP
@@ -324,6 +324,7 @@
 // P0288R9 move_only_function
 // P0323R12 <expected>
 // P0401R6 Providing Size Feedback In The Allocator Interface
+// P0429R9 <flat_map>
 // P0448R4 <spanstream>
 // P0627R6 unreachable()
 // P0798R8 Monadic Operations For optional
@@ -334,6 +335,7 @@
 // P1132R7 out_ptr(), inout_ptr()
 // P1147R1 Printing volatile Pointers
 // P1206R7 Conversions From Ranges To Containers
+// P1222R4 <flat_set>
 // P1223R5 ranges::find_last, ranges::find_last_if, ranges::find_last_if_not
 // P1272R4 byteswap()
 // P1328R1 constexpr type_info::operator==()
@@ -1044,6 +1046,12 @@ _EMIT_STL_ERROR(STL1004, "C++98 unexpected() is incompatible with C++23 unexpect
 #endif // ^^^ floating-point exceptions disabled (default) ^^^
 #endif // !defined(_STD_VECTORIZE_WITH_FLOAT_CONTROL)
 
+// Controls whether parallel algorithms record how they were scheduled, readable through
+// std::execution::get_parallel_statistics() (extension); changes the layout of types in <execution>
+#ifndef _STL_PARALLEL_ALGORITHMS_STATISTICS
+#define _STL_PARALLEL_ALGORITHMS_STATISTICS 0
+#endif // !defined(_STL_PARALLEL_ALGORITHMS_STATISTICS)
+
 // P0174R2 Deprecating Vestigial Library Parts
 // P0521R0 Deprecating shared_ptr::unique()
 // Other C++17 deprecation warnings
@@ -1830,6 +1838,8 @@ _EMIT_STL_ERROR(STL1004, "C++98 unexpected() is incompatible with C++23 unexpect
 #ifdef __cpp_lib_concepts
 #define __cpp_lib_containers_ranges 202202L
 #define __cpp_lib_expected          202211L
+#define __cpp_lib_flat_map          202207L
+#define __cpp_lib_flat_set          202207L
 #define __cpp_lib_formatters        202302L
 #endif // defined(__cpp_lib_concepts)
 
@@ -3,43 +3,480 @@
 
 // support for <execution>
 
+// By default, parallel algorithms submit their work to the Windows thread pool. Setting the environment variable
+// STL_PARALLEL_ALGORITHMS_BACKEND=threads before the first parallel algorithm runs selects a pool of persistent
+// std::thread workers with work-stealing deques instead, whose behavior can be pinned down with:
+// * STL_PARALLEL_ALGORITHMS_THREADS=N: the number of workers (default: thread::hardware_concurrency()). This is also
+//   the value of __std_parallel_algorithms_hw_threads(), so N=1 makes all parallel algorithms run serially.
+// * STL_PARALLEL_ALGORITHMS_AFFINITY=0,2,4-7: binds the i-th worker to the i-th listed logical processor, wrapping
+//   around; processors are numbered as (processor group * 64 + processor number within the group).
+//
+// Independently of the backend, par.with(max_threads, min_chunk) limits individual calls; those limits are kept
+// per calling thread by __std_parallel_algorithms_set_limits() while such a call runs.
+//
+// When <execution> is compiled with _STL_PARALLEL_ALGORITHMS_STATISTICS=1, each thread knows the statistics record of
+// the call it is working on (the calling thread and the workers running that call's callbacks alike), and keeps
+// cumulative statistics of the calls it started. Both are only read and written by the header.
+
+#include <atomic>
+#include <cwchar>
+#include <deque>
 #include <internal_shared.h>
+#include <new>
 #include <thread>
+#include <vector>
 #include <xatomic_wait.h>
 
+namespace {
+    struct _Pool_work { // work object created by __std_create_threadpool_work when the std::thread backend is selected
+        PTP_WORK_CALLBACK _Callback;
+        void* _Context;
+        _STD atomic<size_t> _Outstanding; // submitted callbacks that haven't finished, including those not yet started
+    };
+
+    struct _Pool_task { // _Count callbacks of _Work that haven't started
+        _Pool_work* _Work;
+        size_t _Count;
+    };
+
+#pragma warning(push)
+#pragma warning(disable : 4324) // structure was padded due to alignment specifier
+    struct alignas(_STD hardware_destructive_interference_size) _Worker_queue {
+        SRWLOCK _Lock = SRWLOCK_INIT;
+        _STD deque<_Pool_task> _Tasks; // the owning worker takes from the back, other workers steal from the front
+    };
+#pragma warning(pop)
+
+    class [[nodiscard]] _SrwLock_guard {
+    public:
+        explicit _SrwLock_guard(SRWLOCK& _Locked_) noexcept : _Locked(&_Locked_) {
+            AcquireSRWLockExclusive(_Locked);
+        }
+
+        ~_SrwLock_guard() {
+            ReleaseSRWLockExclusive(_Locked);
+        }
+
+        _SrwLock_guard(const _SrwLock_guard&)            = delete;
+        _SrwLock_guard& operator=(const _SrwLock_guard&) = delete;
+
+    private:
+        SRWLOCK* _Locked;
+    };
+
+    class _Std_thread_pool {
+    public:
+        explicit _Std_thread_pool(const size_t _Worker_count_)
+            : _Worker_count(_Worker_count_), _Queues(_Worker_count_) {}
+
+        _Std_thread_pool(const _Std_thread_pool&)            = delete;
+        _Std_thread_pool& operator=(const _Std_thread_pool&) = delete;
+
+        [[nodiscard]] bool _Start(const _STD vector<unsigned int>& _Affinity) noexcept {
+            // Starts the workers, returning whether any could be started. The queues of workers that couldn't be
+            // started are still drained by the others stealing from them.
+            size_t _Started = 0;
+            for (size_t _Idx = 0; _Idx < _Worker_count; ++_Idx) {
+                try {
+                    _STD thread _Worker{[this, _Idx] { _Run_worker(_Idx); }};
+                    if (!_Affinity.empty()) {
+                        const auto _Processor = _Affinity[_Idx % _Affinity.size()];
+                        GROUP_AFFINITY _Group_affinity{};
+                        _Group_affinity.Mask  = KAFFINITY{1} << (_Processor % 64);
+                        _Group_affinity.Group = static_cast<WORD>(_Processor / 64);
+                        (void) SetThreadGroupAffinity(_Worker.native_handle(), &_Group_affinity, nullptr);
+                    }
+
+                    // The pool lives until the process exits, so the workers are never joined.
+                    _Worker.detach();
+                    ++_Started;
+                } catch (...) {
+                    // run with the workers that could be started
+                }
+            }
+
+            return _Started != 0;
+        }
+
+        [[nodiscard]] size_t _Get_worker_count() const noexcept {
+            return _Worker_count;
+        }
+
+        void _Submit(_Pool_work* const _Work, const size_t _Count) noexcept {
+            // Spreads _Count callbacks of _Work over the queues, then wakes the workers once.
+            if (_Count == 0) {
+                return;
+            }
+
+            _Work->_Outstanding.fetch_add(_Count);
+            _Queued.fetch_add(_Count);
+            const size_t _Per_queue = _Count / _Worker_count;
+            size_t _Remainder       = _Count % _Worker_count;
+            size_t _Idx             = _Next_queue.fetch_add(1, _STD memory_order_relaxed);
+            for (size_t _Pushed = 0; _Pushed < _Worker_count; ++_Pushed, ++_Idx) {
+                size_t _Task_count = _Per_queue;
+                if (_Remainder != 0) {
+                    ++_Task_count;
+                    --_Remainder;
+                }
+
+                if (_Task_count == 0) {
+                    break;
+                }
+
+                auto& _Queue = _Queues[_Idx % _Worker_count];
+                _SrwLock_guard _Guard{_Queue._Lock};
+                _Queue._Tasks.push_back({_Work, _Task_count}); // terminates on allocation failure
+            }
+
+            {
+                // ensure workers that saw no queued callbacks are asleep before waking them
+                _SrwLock_guard _Guard{_Sleep_lock};
+            }
+
+            if (_Count == 1) {
+                WakeConditionVariable(&_Sleep_condition);
+            } else {
+                WakeAllConditionVariable(&_Sleep_condition);
+            }
+        }
+
+        void _Wait(_Pool_work* const _Work, const bool _Cancel) noexcept {
+            // Waits for the callbacks of _Work to finish, first removing those that haven't started if _Cancel.
+            if (_Cancel) {
+                size_t _Canceled = 0;
+                for (auto& _Queue : _Queues) {
+                    _SrwLock_guard _Guard{_Queue._Lock};
+                    auto& _Tasks = _Queue._Tasks;
+                    for (auto _Next = _Tasks.begin(); _Next != _Tasks.end();) {
+                        if (_Next->_Work == _Work) {
+                            _Canceled += _Next->_Count;
+                            _Next = _Tasks.erase(_Next);
+                        } else {
+                            ++_Next;
+                        }
+                    }
+                }
+
+                _Queued.fetch_sub(_Canceled);
+                _Work->_Outstanding.fetch_sub(_Canceled);
+            }
+
+            for (;;) {
+                size_t _Outstanding = _Work->_Outstanding.load();
+                if (_Outstanding == 0) {
+                    return;
+                }
+
+                __std_atomic_wait_direct(
+                    &_Work->_Outstanding, &_Outstanding, sizeof(_Outstanding), __std_atomic_wait_no_timeout);
+            }
+        }
+
+    private:
+        [[nodiscard]] _Pool_work* _Take_own(const size_t _Self) noexcept {
+            auto& _Queue = _Queues[_Self];
+            _SrwLock_guard _Guard{_Queue._Lock};
+            auto& _Tasks = _Queue._Tasks;
+            if (_Tasks.empty()) {
+                return nullptr;
+            }
+
+            auto& _Task      = _Tasks.back();
+            const auto _Work = _Task._Work;
+            if (--_Task._Count == 0) {
+                _Tasks.pop_back();
+            }
+
+            return _Work;
+        }
+
+        [[nodiscard]] _Pool_work* _Steal(const size_t _Self) noexcept {
+            // Takes half of the oldest task of another worker, running one callback and keeping the rest.
+            for (size_t _Offset = 1; _Offset < _Worker_count; ++_Offset) {
+                _Pool_task _Stolen;
+                {
+                    auto& _Queue = _Queues[(_Self + _Offset) % _Worker_count];
+                    _SrwLock_guard _Guard{_Queue._Lock};
+                    auto& _Tasks = _Queue._Tasks;
+                    if (_Tasks.empty()) {
+                        continue;
+                    }
+
+                    auto& _Task    = _Tasks.front();
+                    _Stolen._Work  = _Task._Work;
+                    _Stolen._Count = (_Task._Count + 1) / 2;
+                    _Task._Count -= _Stolen._Count;
+                    if (_Task._Count == 0) {
+                        _Tasks.pop_front();
+                    }
+                }
+
+                if (--_Stolen._Count != 0) {
+                    auto& _Queue = _Queues[_Self];
+                    _SrwLock_guard _Guard{_Queue._Lock};
+                    _Queue._Tasks.push_back(_Stolen); // terminates on allocation failure
+                }
+
+                return _Stolen._Work;
+            }
+
+            return nullptr;
+        }
+
+        void _Run_worker(const size_t _Self) noexcept {
+            for (;;) {
+                auto _Work = _Take_own(_Self);
+                if (!_Work) {
+                    _Work = _Steal(_Self);
+                }
+
+                if (!_Work) {
+                    // Sleep until more callbacks are submitted. A callback that was counted in _Queued but not found
+                    // is being moved between queues by a thief or was just submitted; try again.
+                    _SrwLock_guard _Guard{_Sleep_lock};
+                    while (_Queued.load() == 0) {
+                        (void) SleepConditionVariableSRW(&_Sleep_condition, &_Sleep_lock, INFINITE, 0);
+                    }
+
+                    continue;
+                }
+
+                _Queued.fetch_sub(1);
+                _Work->_Callback(nullptr, _Work->_Context, reinterpret_cast<PTP_WORK>(_Work));
+                if (_Work->_Outstanding.fetch_sub(1) == 1) {
+                    __std_atomic_notify_all_direct(&_Work->_Outstanding);
+                }
+            }
+        }
+
+        size_t _Worker_count;
+        _STD vector<_Worker_queue> _Queues;
+        _STD atomic<size_t> _Queued{0}; // callbacks that haven't started, in all queues
+        _STD atomic<size_t> _Next_queue{0}; // rotates the first queue that submissions go to
+        SRWLOCK _Sleep_lock                 = SRWLOCK_INIT;
+        CONDITION_VARIABLE _Sleep_condition = CONDITION_VARIABLE_INIT;
+    };
+
+    [[nodiscard]] bool _Get_environment(const wchar_t* const _Name, wchar_t (&_Buffer)[256]) noexcept {
+        const auto _Length = GetEnvironmentVariableW(_Name, _Buffer, 256);
+        return _Length != 0 && _Length < 256;
+    }
+
+    [[nodiscard]] bool _Parse_unsigned(const wchar_t*& _First, unsigned int& _Val) noexcept {
+        // parses a decimal number at _First, advancing _First past it
+        if (*_First < L'0' || *_First > L'9') {
+            return false;
+        }
+
+        _Val = 0;
+        for (; *_First >= L'0' && *_First <= L'9'; ++_First) {
+            if (_Val > 100'000) { // way beyond any worker count or processor number
+                return false;
+            }
+
+            _Val = _Val * 10 + static_cast<unsigned int>(*_First - L'0');
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] _STD vector<unsigned int> _Parse_affinity(const wchar_t* _First) {
+        // parses a comma-separated list of processor numbers and ranges of them, like "0,2,4-7"
+        _STD vector<unsigned int> _Result;
+        for (;;) {
+            unsigned int _Low;
+            if (!_Parse_unsigned(_First, _Low)) {
+                return {};
+            }
+
+            unsigned int _High = _Low;
+            if (*_First == L'-') {
+                ++_First;
+                if (!_Parse_unsigned(_First, _High) || _High < _Low) {
+                    return {};
+                }
+            }
+
+            for (unsigned int _Processor = _Low; _Processor <= _High; ++_Processor) {
+                _Result.push_back(_Processor);
+            }
+
+            if (*_First == L'\0') {
+                return _Result;
+            }
+
+            if (*_First != L',') {
+                return {};
+            }
+
+            ++_First;
+        }
+    }
+
+    _Std_thread_pool* _Selected_std_thread_pool = nullptr;
+
+    BOOL CALLBACK _Select_backend(PINIT_ONCE, PVOID, PVOID*) noexcept {
+        wchar_t _Buffer[256];
+        if (!_Get_environment(L"STL_PARALLEL_ALGORITHMS_BACKEND", _Buffer) || wcscmp(_Buffer, L"threads") != 0) {
+            return TRUE; // use the Windows thread pool
+        }
+
+        unsigned int _Worker_count = _STD thread::hardware_concurrency();
+        if (_Get_environment(L"STL_PARALLEL_ALGORITHMS_THREADS", _Buffer)) {
+            const wchar_t* _First = _Buffer;
+            unsigned int _Requested;
+            if (_Parse_unsigned(_First, _Requested) && *_First == L'\0' && _Requested != 0) {
+                _Worker_count = _Requested;
+            }
+        }
+
+        if (_Worker_count == 0) {
+            _Worker_count = 1;
+        }
+
+        try {
+            _STD vector<unsigned int> _Affinity;
+            if (_Get_environment(L"STL_PARALLEL_ALGORITHMS_AFFINITY", _Buffer)) {
+                _Affinity = _Parse_affinity(_Buffer);
+            }
+
+            // The pool lives until the process exits; its workers may be running when static destructors run.
+            const auto _Pool = new _Std_thread_pool(_Worker_count);
+            if (_Pool->_Start(_Affinity)) {
+                _Selected_std_thread_pool = _Pool;
+            } else {
+                delete _Pool; // no workers are referring to it
+            }
+        } catch (...) {
+            // use the Windows thread pool
+        }
+
+        return TRUE;
+    }
+
+    [[nodiscard]] _Std_thread_pool* _Get_std_thread_pool() noexcept {
+        // returns the std::thread pool if it was selected and could be started, otherwise nullptr
+        static INIT_ONCE _Once = INIT_ONCE_STATIC_INIT;
+        (void) InitOnceExecuteOnce(&_Once, _Select_backend, nullptr, nullptr);
+        return _Selected_std_thread_pool;
+    }
+} // unnamed namespace
+
+struct __std_parallel_algorithms_limits { // applies to parallel algorithms started on the calling thread
+    unsigned int _Max_threads; // 0 means unlimited
+    size_t _Min_chunk; // 0 means unlimited
+};
+
+struct __std_parallel_algorithms_statistics { // of parallel algorithms started on the calling thread
+    size_t _Calls;
+    size_t _Chunks;
+    size_t _Steals;
+    size_t _Serial_fallbacks;
+    unsigned long long _Wait_ns;
+};
+
+namespace {
+    // all constant-initialized, so no TLS callback
+    thread_local __std_parallel_algorithms_limits _Thread_limits{};
+    thread_local __std_parallel_algorithms_statistics _Thread_statistics{};
+    thread_local void* _Thread_statistics_record = nullptr;
+} // unnamed namespace
+
 extern "C" {
 
+[[nodiscard]] __std_parallel_algorithms_limits __stdcall __std_parallel_algorithms_get_limits() noexcept {
+    return _Thread_limits;
+}
+
+void __stdcall __std_parallel_algorithms_set_limits(const __std_parallel_algorithms_limits _Limits) noexcept {
+    _Thread_limits = _Limits;
+}
+
+[[nodiscard]] __std_parallel_algorithms_statistics __stdcall __std_parallel_algorithms_get_statistics() noexcept {
+    return _Thread_statistics;
+}
+
+void __stdcall __std_parallel_algorithms_set_statistics(
+    const __std_parallel_algorithms_statistics _Statistics) noexcept {
+    _Thread_statistics = _Statistics;
+}
+
+[[nodiscard]] void* __stdcall __std_parallel_algorithms_get_statistics_record() noexcept {
+    return _Thread_statistics_record;
+}
+
+void __stdcall __std_parallel_algorithms_set_statistics_record(void* const _Record) noexcept {
+    _Thread_statistics_record = _Record;
+}
+
 [[nodiscard]] unsigned int __stdcall __std_parallel_algorithms_hw_threads() noexcept {
     static int _Cached_hw_concurrency = -1;
     int _Hw_concurrency               = __iso_volatile_load32(&_Cached_hw_concurrency);
     if (_Hw_concurrency == -1) {
-        _Hw_concurrency = static_cast<int>(_STD thread::hardware_concurrency());
+        if (const auto _Pool = _Get_std_thread_pool()) {
+            _Hw_concurrency = static_cast<int>(_Pool->_Get_worker_count());
+        } else {
+            _Hw_concurrency = static_cast<int>(_STD thread::hardware_concurrency());
+        }
+
         __iso_volatile_store32(&_Cached_hw_concurrency, _Hw_concurrency);
     }
 
+    const unsigned int _Max_threads = _Thread_limits._Max_threads;
+    if (_Max_threads != 0 && _Max_threads < static_cast<unsigned int>(_Hw_concurrency)) {
+        return _Max_threads;
+    }
+
     return static_cast<unsigned int>(_Hw_concurrency);
 }
 
 [[nodiscard]] PTP_WORK __stdcall __std_create_threadpool_work(
     PTP_WORK_CALLBACK _Callback, void* _Context, PTP_CALLBACK_ENVIRON _Callback_environ) noexcept {
+    if (_Get_std_thread_pool()) {
+        return reinterpret_cast<PTP_WORK>(new (_STD nothrow) _Pool_work{_Callback, _Context, 0});
+    }
+
     return CreateThreadpoolWork(_Callback, _Context, _Callback_environ);
 }
 
 void __stdcall __std_submit_threadpool_work(PTP_WORK _Work) noexcept {
+    if (const auto _Pool = _Get_std_thread_pool()) {
+        _Pool->_Submit(reinterpret_cast<_Pool_work*>(_Work), 1);
+        return;
+    }
+
     SubmitThreadpoolWork(_Work);
 }
 
 void __stdcall __std_bulk_submit_threadpool_work(PTP_WORK _Work, const size_t _Submissions) noexcept {
+    if (const auto _Pool = _Get_std_thread_pool()) {
+        _Pool->_Submit(reinterpret_cast<_Pool_work*>(_Work), _Submissions);
+        return;
+    }
+
     for (size_t _Idx = 0; _Idx < _Submissions; ++_Idx) {
         SubmitThreadpoolWork(_Work);
     }
 }
 
 void __stdcall __std_close_threadpool_work(PTP_WORK _Work) noexcept {
+    if (const auto _Pool = _Get_std_thread_pool()) {
+        // like CloseThreadpoolWork, let outstanding callbacks finish before releasing the work object
+        _Pool->_Wait(reinterpret_cast<_Pool_work*>(_Work), false);
+        delete reinterpret_cast<_Pool_work*>(_Work);
+        return;
+    }
+
     CloseThreadpoolWork(_Work);
 }
 
 void __stdcall __std_wait_for_threadpool_work_callbacks(PTP_WORK _Work, BOOL _Cancel) noexcept {
+    if (const auto _Pool = _Get_std_thread_pool()) {
+        _Pool->_Wait(reinterpret_cast<_Pool_work*>(_Work), _Cancel != FALSE);
+        return;
+    }
+
     WaitForThreadpoolWorkCallbacks(_Work, _Cancel);
 }
 
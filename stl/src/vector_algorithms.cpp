@@ -7,6 +7,7 @@
 
 #if defined(_M_IX86) || defined(_M_X64) // NB: includes _M_ARM64EC
 #include <cstdint>
+#include <cstring>
 #ifndef _M_ARM64EC
 #include <intrin.h>
 #include <isa_availability.h>
@@ -550,6 +551,8 @@ namespace {
         static constexpr _Signed_t _Init_min_val = static_cast<_Signed_t>(0x7F);
         static constexpr _Signed_t _Init_max_val = static_cast<_Signed_t>(0x80);
 
+        static constexpr bool _Is_floating = false;
+
 #ifndef _M_ARM64EC
         static constexpr bool _Has_portion_max = true;
         static constexpr size_t _Portion_max   = 256;
@@ -626,6 +629,8 @@ namespace {
         static constexpr _Signed_t _Init_min_val = static_cast<_Signed_t>(0x7FFF);
         static constexpr _Signed_t _Init_max_val = static_cast<_Signed_t>(0x8000);
 
+        static constexpr bool _Is_floating = false;
+
 #ifndef _M_ARM64EC
         static constexpr bool _Has_portion_max = true;
         static constexpr size_t _Portion_max   = 65536;
@@ -703,6 +708,8 @@ namespace {
         static constexpr _Signed_t _Init_min_val = static_cast<_Signed_t>(0x7FFF'FFFFUL);
         static constexpr _Signed_t _Init_max_val = static_cast<_Signed_t>(0x8000'0000UL);
 
+        static constexpr bool _Is_floating = false;
+
 #ifndef _M_ARM64EC
 #ifdef _M_IX86
         static constexpr bool _Has_portion_max = false;
@@ -780,6 +787,8 @@ namespace {
         static constexpr _Signed_t _Init_min_val = static_cast<_Signed_t>(0x7FFF'FFFF'FFFF'FFFFULL);
         static constexpr _Signed_t _Init_max_val = static_cast<_Signed_t>(0x8000'0000'0000'0000ULL);
 
+        static constexpr bool _Is_floating = false;
+
 #ifndef _M_ARM64EC
         static constexpr bool _Has_portion_max = false;
 
@@ -853,6 +862,35 @@ namespace {
 #endif // !_M_ARM64EC
     };
 
+    // The floating-point traits reuse the integer machinery on keys: the bits of each value, transformed so that
+    // signed integer comparisons of the keys agree with floating-point comparisons of the values.
+    // Negative values get their magnitude negated, so -0.0 and +0.0 get the same key, as they are equivalent.
+    struct _Minmax_traits_f : _Minmax_traits_4 {
+        using _Float_t = float;
+
+        static constexpr bool _Is_floating = true;
+
+#ifndef _M_ARM64EC
+        static __m128i _Sign_correction(const __m128i _Val, bool) noexcept {
+            const __m128i _Neg = _mm_srai_epi32(_Val, 31);
+            return _mm_sub_epi32(_mm_xor_si128(_Val, _mm_srli_epi32(_Neg, 1)), _Neg);
+        }
+#endif // !_M_ARM64EC
+    };
+
+    struct _Minmax_traits_d : _Minmax_traits_8 {
+        using _Float_t = double;
+
+        static constexpr bool _Is_floating = true;
+
+#ifndef _M_ARM64EC
+        static __m128i _Sign_correction(const __m128i _Val, bool) noexcept {
+            const __m128i _Neg = _mm_cmpgt_epi64(_mm_setzero_si128(), _Val); // no _mm_srai_epi64 before AVX-512
+            return _mm_sub_epi64(_mm_xor_si128(_Val, _mm_srli_epi64(_Neg, 1)), _Neg);
+        }
+#endif // !_M_ARM64EC
+    };
+
     // _Minmax_element has exactly the same signature as the extern "C" functions
     // (__std_min_element_N, __std_max_element_N, __std_minmax_element_N), up to calling convention.
     // This makes sure the template specialization is fused with the extern "C" function.
@@ -1036,30 +1074,55 @@ namespace {
             }
         }
 #endif // !_M_ARM64EC
-        using _STy = _Traits::_Signed_t;
-        using _UTy = _Traits::_Unsigned_t;
+        if constexpr (_Traits::_Is_floating) {
+            // _Cur_min_val and _Cur_max_val are keys, not values, so continue from the elements _Res points to.
+            // When there is nothing left, don't look at them: the range may be empty.
+            if (_First == _Last) {
+                if constexpr (_Mode == _Mode_min) {
+                    return _Res._Min;
+                } else if constexpr (_Mode == _Mode_max) {
+                    return _Res._Max;
+                } else {
+                    return _Res;
+                }
+            }
 
-        constexpr _UTy _Correction = _UTy{1} << (sizeof(_UTy) * 8 - 1);
+            using _FTy = _Traits::_Float_t;
 
-        if constexpr (_Mode == _Mode_min) {
-            if (_Sign) {
-                return _Min_tail(_First, _Last, _Res._Min, static_cast<_STy>(_Cur_min_val));
+            if constexpr (_Mode == _Mode_min) {
+                return _Min_tail(_First, _Last, _Res._Min, *static_cast<const _FTy*>(_Res._Min));
+            } else if constexpr (_Mode == _Mode_max) {
+                return _Max_tail(_First, _Last, _Res._Max, *static_cast<const _FTy*>(_Res._Max));
             } else {
-                return _Min_tail(_First, _Last, _Res._Min, static_cast<_UTy>(_Cur_min_val + _Correction));
-            }
-        } else if constexpr (_Mode == _Mode_max) {
-            if (_Sign) {
-                return _Max_tail(_First, _Last, _Res._Max, static_cast<_STy>(_Cur_max_val));
-            } else {
-                return _Max_tail(_First, _Last, _Res._Max, static_cast<_UTy>(_Cur_max_val + _Correction));
+                return _Both_tail(_First, _Last, _Res, *static_cast<const _FTy*>(_Res._Min),
+                    *static_cast<const _FTy*>(_Res._Max));
             }
         } else {
-            if (_Sign) {
-                return _Both_tail(
-                    _First, _Last, _Res, static_cast<_STy>(_Cur_min_val), static_cast<_STy>(_Cur_max_val));
+            using _STy = _Traits::_Signed_t;
+            using _UTy = _Traits::_Unsigned_t;
+
+            constexpr _UTy _Correction = _UTy{1} << (sizeof(_UTy) * 8 - 1);
+
+            if constexpr (_Mode == _Mode_min) {
+                if (_Sign) {
+                    return _Min_tail(_First, _Last, _Res._Min, static_cast<_STy>(_Cur_min_val));
+                } else {
+                    return _Min_tail(_First, _Last, _Res._Min, static_cast<_UTy>(_Cur_min_val + _Correction));
+                }
+            } else if constexpr (_Mode == _Mode_max) {
+                if (_Sign) {
+                    return _Max_tail(_First, _Last, _Res._Max, static_cast<_STy>(_Cur_max_val));
+                } else {
+                    return _Max_tail(_First, _Last, _Res._Max, static_cast<_UTy>(_Cur_max_val + _Correction));
+                }
             } else {
-                return _Both_tail(_First, _Last, _Res, static_cast<_UTy>(_Cur_min_val + _Correction),
-                    static_cast<_UTy>(_Cur_max_val + _Correction));
+                if (_Sign) {
+                    return _Both_tail(
+                        _First, _Last, _Res, static_cast<_STy>(_Cur_min_val), static_cast<_STy>(_Cur_max_val));
+                } else {
+                    return _Both_tail(_First, _Last, _Res, static_cast<_UTy>(_Cur_min_val + _Correction),
+                        static_cast<_UTy>(_Cur_max_val + _Correction));
+                }
             }
         }
     }
@@ -1088,6 +1151,16 @@ const void* __stdcall __std_min_element_8(
     return _Minmax_element<_Mode_min, _Minmax_traits_8>(_First, _Last, _Signed);
 }
 
+const void* __stdcall __std_min_element_f(
+    const void* const _First, const void* const _Last, const bool _Unused) noexcept {
+    return _Minmax_element<_Mode_min, _Minmax_traits_f>(_First, _Last, _Unused);
+}
+
+const void* __stdcall __std_min_element_d(
+    const void* const _First, const void* const _Last, const bool _Unused) noexcept {
+    return _Minmax_element<_Mode_min, _Minmax_traits_d>(_First, _Last, _Unused);
+}
+
 const void* __stdcall __std_max_element_1(
     const void* const _First, const void* const _Last, const bool _Signed) noexcept {
     return _Minmax_element<_Mode_max, _Minmax_traits_1>(_First, _Last, _Signed);
@@ -1108,6 +1181,16 @@ const void* __stdcall __std_max_element_8(
     return _Minmax_element<_Mode_max, _Minmax_traits_8>(_First, _Last, _Signed);
 }
 
+const void* __stdcall __std_max_element_f(
+    const void* const _First, const void* const _Last, const bool _Unused) noexcept {
+    return _Minmax_element<_Mode_max, _Minmax_traits_f>(_First, _Last, _Unused);
+}
+
+const void* __stdcall __std_max_element_d(
+    const void* const _First, const void* const _Last, const bool _Unused) noexcept {
+    return _Minmax_element<_Mode_max, _Minmax_traits_d>(_First, _Last, _Unused);
+}
+
 _Min_max_element_t __stdcall __std_minmax_element_1(
     const void* const _First, const void* const _Last, const bool _Signed) noexcept {
     return _Minmax_element<_Mode_both, _Minmax_traits_1>(_First, _Last, _Signed);
@@ -1128,6 +1211,16 @@ _Min_max_element_t __stdcall __std_minmax_element_8(
     return _Minmax_element<_Mode_both, _Minmax_traits_8>(_First, _Last, _Signed);
 }
 
+_Min_max_element_t __stdcall __std_minmax_element_f(
+    const void* const _First, const void* const _Last, const bool _Unused) noexcept {
+    return _Minmax_element<_Mode_both, _Minmax_traits_f>(_First, _Last, _Unused);
+}
+
+_Min_max_element_t __stdcall __std_minmax_element_d(
+    const void* const _First, const void* const _Last, const bool _Unused) noexcept {
+    return _Minmax_element<_Mode_both, _Minmax_traits_d>(_First, _Last, _Unused);
+}
+
 } // extern "C"
 
 namespace {
@@ -1483,6 +1576,120 @@ namespace {
         }
         return _Result;
     }
+
+    template <class _Traits, class _Ty>
+    const void* __stdcall __std_search_impl(
+        const void* _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+        if (_Count2 == 0) {
+            return _First1;
+        }
+
+        const auto _Needle = static_cast<const _Ty*>(_First2);
+        if (_Count2 == 1) {
+            return __std_find_trivial_impl<_Traits>(_First1, _Last1, *_Needle);
+        }
+
+        const size_t _Size_bytes_1 = _Byte_length(_First1, _Last1);
+        const size_t _Size_bytes_2 = _Count2 * sizeof(_Ty);
+        if (_Size_bytes_1 < _Size_bytes_2) {
+            return _Last1;
+        }
+
+        const _Ty _First_val          = _Needle[0];
+        const _Ty _Last_val           = _Needle[_Count2 - 1];
+        const size_t _Last_val_offset = _Size_bytes_2 - sizeof(_Ty); // byte offset of the needle's last element
+        const size_t _Mid_size_bytes  = _Size_bytes_2 - 2 * sizeof(_Ty); // bytes strictly between first and last
+        const void* const _Mid2       = _Needle + 1;
+
+        // Byte length of the range of positions where a match could start
+        size_t _Starts_size_bytes = _Size_bytes_1 - _Last_val_offset;
+
+#ifndef _M_ARM64EC
+        // We compare the needle's first and last elements against a vector of candidate positions at once,
+        // and only compare the middle part of the needle for the candidates where both of them match.
+        // The loads for the last element end at most at _Last1, so we never read outside of the haystack.
+        const size_t _Avx_size = _Starts_size_bytes & ~size_t{0x1F};
+        if (_Avx_size != 0 && _Use_avx2()) {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            const __m256i _Comparand_first = _Traits::_Set_avx(_First_val);
+            const __m256i _Comparand_last  = _Traits::_Set_avx(_Last_val);
+            const void* _Stop_at           = _First1;
+            _Advance_bytes(_Stop_at, _Avx_size);
+            do {
+                const void* _Tail = _First1;
+                _Advance_bytes(_Tail, _Last_val_offset);
+                const __m256i _Data_first = _mm256_loadu_si256(static_cast<const __m256i*>(_First1));
+                const __m256i _Data_last  = _mm256_loadu_si256(static_cast<const __m256i*>(_Tail));
+                const __m256i _Eq_first   = _Traits::_Cmp_avx(_Data_first, _Comparand_first);
+                const __m256i _Eq_last    = _Traits::_Cmp_avx(_Data_last, _Comparand_last);
+                const __m256i _Eq_both    = _mm256_and_si256(_Eq_first, _Eq_last);
+                unsigned int _Bingo       = static_cast<unsigned int>(_mm256_movemask_epi8(_Eq_both));
+
+                while (_Bingo != 0) {
+                    const unsigned long _Offset = _tzcnt_u32(_Bingo);
+                    const void* _Match          = _First1;
+                    _Advance_bytes(_Match, _Offset);
+                    const void* _Mid1 = _Match;
+                    _Advance_bytes(_Mid1, sizeof(_Ty));
+                    if (memcmp(_Mid1, _Mid2, _Mid_size_bytes) == 0) {
+                        return _Match;
+                    }
+
+                    _Bingo ^= ((1U << sizeof(_Ty)) - 1) << _Offset; // clear all bytes of this candidate element
+                }
+
+                _Advance_bytes(_First1, 32);
+            } while (_First1 != _Stop_at);
+            _Starts_size_bytes &= 0x1F;
+        }
+
+        const size_t _Sse_size = _Starts_size_bytes & ~size_t{0xF};
+        if (_Sse_size != 0 && _Traits::_Sse_available()) {
+            const __m128i _Comparand_first = _Traits::_Set_sse(_First_val);
+            const __m128i _Comparand_last  = _Traits::_Set_sse(_Last_val);
+            const void* _Stop_at           = _First1;
+            _Advance_bytes(_Stop_at, _Sse_size);
+            do {
+                const void* _Tail = _First1;
+                _Advance_bytes(_Tail, _Last_val_offset);
+                const __m128i _Data_first = _mm_loadu_si128(static_cast<const __m128i*>(_First1));
+                const __m128i _Data_last  = _mm_loadu_si128(static_cast<const __m128i*>(_Tail));
+                const __m128i _Eq_first   = _Traits::_Cmp_sse(_Data_first, _Comparand_first);
+                const __m128i _Eq_last    = _Traits::_Cmp_sse(_Data_last, _Comparand_last);
+                const __m128i _Eq_both    = _mm_and_si128(_Eq_first, _Eq_last);
+                unsigned int _Bingo       = static_cast<unsigned int>(_mm_movemask_epi8(_Eq_both));
+
+                while (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo); // lgtm [cpp/conditionallyuninitializedvariable]
+                    const void* _Match = _First1;
+                    _Advance_bytes(_Match, _Offset);
+                    const void* _Mid1 = _Match;
+                    _Advance_bytes(_Mid1, sizeof(_Ty));
+                    if (memcmp(_Mid1, _Mid2, _Mid_size_bytes) == 0) {
+                        return _Match;
+                    }
+
+                    _Bingo ^= ((1U << sizeof(_Ty)) - 1) << _Offset; // clear all bytes of this candidate element
+                }
+
+                _Advance_bytes(_First1, 16);
+            } while (_First1 != _Stop_at);
+            _Starts_size_bytes &= 0xF;
+        }
+#endif // !_M_ARM64EC
+        auto _Ptr             = static_cast<const _Ty*>(_First1);
+        const auto _Stop_at_p = _Ptr + (_Starts_size_bytes >> _Traits::_Shift);
+        for (; _Ptr != _Stop_at_p; ++_Ptr) {
+            if (*_Ptr == _First_val && _Ptr[_Count2 - 1] == _Last_val
+                && memcmp(_Ptr + 1, _Mid2, _Mid_size_bytes) == 0) {
+                return _Ptr;
+            }
+        }
+
+        return _Last1;
+    }
 } // unnamed namespace
 
 extern "C" {
@@ -1563,5 +1770,1763 @@ __declspec(noalias) size_t
     return __std_count_trivial_impl<_Find_traits_8>(_First, _Last, _Val);
 }
 
+const void* __stdcall __std_search_1(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return __std_search_impl<_Find_traits_1, uint8_t>(_First1, _Last1, _First2, _Count2);
+}
+
+const void* __stdcall __std_search_2(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return __std_search_impl<_Find_traits_2, uint16_t>(_First1, _Last1, _First2, _Count2);
+}
+
+const void* __stdcall __std_search_4(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return __std_search_impl<_Find_traits_4, uint32_t>(_First1, _Last1, _First2, _Count2);
+}
+
+const void* __stdcall __std_search_8(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return __std_search_impl<_Find_traits_8, uint64_t>(_First1, _Last1, _First2, _Count2);
+}
+
+} // extern "C"
+
+namespace {
+    enum _Find_of_mode {
+        _Find_of_negated  = 1 << 0, // looking for an element that is not equal to any of the needle elements
+        _Find_of_backward = 1 << 1, // looking for the last such element instead of the first one
+
+        _Mode_first_of     = 0,
+        _Mode_first_not_of = _Find_of_negated,
+        _Mode_last_of      = _Find_of_backward,
+        _Mode_last_not_of  = _Find_of_negated | _Find_of_backward,
+    };
+
+    template <_Find_of_mode _Mode, class _Ty, class _Pred>
+    size_t _Find_of_pos_scalar(const _Ty* const _Haystack, const size_t _Haystack_length, _Pred _In_needle) noexcept {
+        constexpr bool _Negated = (_Mode & _Find_of_negated) != 0;
+
+        if constexpr ((_Mode & _Find_of_backward) == 0) {
+            for (size_t _Pos = 0; _Pos != _Haystack_length; ++_Pos) {
+                if (_In_needle(_Haystack[_Pos]) != _Negated) {
+                    return _Pos;
+                }
+            }
+        } else {
+            for (size_t _Pos = _Haystack_length; _Pos != 0;) {
+                --_Pos;
+                if (_In_needle(_Haystack[_Pos]) != _Negated) {
+                    return _Pos;
+                }
+            }
+        }
+
+        return static_cast<size_t>(-1);
+    }
+
+    template <_Find_of_mode _Mode, class _Ty>
+    size_t _Find_of_pos_linear(const _Ty* const _Haystack, const size_t _Haystack_length, const _Ty* const _Needle,
+        const size_t _Needle_length) noexcept {
+        return _Find_of_pos_scalar<_Mode>(_Haystack, _Haystack_length, [=](const _Ty _Val) noexcept {
+            for (size_t _Idx = 0; _Idx != _Needle_length; ++_Idx) {
+                if (_Needle[_Idx] == _Val) {
+                    return true;
+                }
+            }
+
+            return false;
+        });
+    }
+
+#ifndef _M_ARM64EC
+    // The matchers below classify a whole vector of haystack elements at once.
+    // _Match returns a mask with one bit per byte, set for the bytes of the elements found in the needle.
+
+    template <_Find_of_mode _Mode, class _Ty, class _Matcher>
+    size_t _Find_of_pos_vectorized(
+        const _Matcher& _Match, const void* const _Haystack, const size_t _Haystack_length) noexcept {
+        constexpr size_t _Elems          = _Matcher::_Vec_size / sizeof(_Ty);
+        constexpr unsigned int _Vec_mask = static_cast<unsigned int>((uint64_t{1} << _Matcher::_Vec_size) - 1);
+        constexpr unsigned int _Negate   = (_Mode & _Find_of_negated) != 0 ? _Vec_mask : 0;
+
+        const auto _Hay = static_cast<const _Ty*>(_Haystack);
+        unsigned long _Offset;
+
+        if constexpr ((_Mode & _Find_of_backward) == 0) {
+            size_t _Pos = 0;
+            for (; _Haystack_length - _Pos >= _Elems; _Pos += _Elems) {
+                const unsigned int _Bingo = (_Match._Match(_Hay + _Pos) ^ _Negate) & _Vec_mask;
+                if (_Bingo != 0) {
+                    _BitScanForward(&_Offset, _Bingo); // lgtm [cpp/conditionallyuninitializedvariable]
+                    return _Pos + _Offset / sizeof(_Ty);
+                }
+            }
+
+            const size_t _Tail_length = _Haystack_length - _Pos;
+            if (_Tail_length != 0) {
+                _Ty _Tail[_Elems] = {};
+                memcpy(_Tail, _Hay + _Pos, _Tail_length * sizeof(_Ty));
+
+                const unsigned int _Tail_mask = (1U << (_Tail_length * sizeof(_Ty))) - 1;
+                const unsigned int _Bingo     = (_Match._Match(_Tail) ^ _Negate) & _Tail_mask;
+                if (_Bingo != 0) {
+                    _BitScanForward(&_Offset, _Bingo); // lgtm [cpp/conditionallyuninitializedvariable]
+                    return _Pos + _Offset / sizeof(_Ty);
+                }
+            }
+        } else {
+            size_t _Pos = _Haystack_length;
+            while (_Pos >= _Elems) {
+                _Pos -= _Elems;
+                const unsigned int _Bingo = (_Match._Match(_Hay + _Pos) ^ _Negate) & _Vec_mask;
+                if (_Bingo != 0) {
+                    _BitScanReverse(&_Offset, _Bingo); // lgtm [cpp/conditionallyuninitializedvariable]
+                    return _Pos + _Offset / sizeof(_Ty);
+                }
+            }
+
+            if (_Pos != 0) {
+                _Ty _Head[_Elems] = {};
+                memcpy(_Head, _Hay, _Pos * sizeof(_Ty));
+
+                const unsigned int _Head_mask = (1U << (_Pos * sizeof(_Ty))) - 1;
+                const unsigned int _Bingo     = (_Match._Match(_Head) ^ _Negate) & _Head_mask;
+                if (_Bingo != 0) {
+                    _BitScanReverse(&_Offset, _Bingo); // lgtm [cpp/conditionallyuninitializedvariable]
+                    return _Offset / sizeof(_Ty);
+                }
+            }
+        }
+
+        return static_cast<size_t>(-1);
+    }
+
+    // For 1-byte elements, the needle is turned into a bitmap indexed by the low nibble of the element, whose entries
+    // hold one bit per high nibble. pshufb looks up 16 or 32 entries at once, for needles of any length.
+    struct _Find_of_nibble_tables {
+        // needle byte _Ch sets bit ((_Ch >> 4) & 7) of _Lo[_Ch & 0xF] when _Ch < 0x80, and of _Hi[_Ch & 0xF] otherwise
+        alignas(16) uint8_t _Lo[16] = {};
+        alignas(16) uint8_t _Hi[16] = {};
+
+        _Find_of_nibble_tables(const uint8_t* _First, const uint8_t* const _Last) noexcept {
+            for (; _First != _Last; ++_First) {
+                const uint8_t _Ch = *_First;
+                (_Ch < 0x80 ? _Lo : _Hi)[_Ch & 0xF] |= static_cast<uint8_t>(1 << ((_Ch >> 4) & 7));
+            }
+        }
+    };
+
+    struct _Find_of_matcher_nibble_sse {
+        static constexpr size_t _Vec_size = 16;
+
+        __m128i _Lo;
+        __m128i _Hi;
+
+        explicit _Find_of_matcher_nibble_sse(const _Find_of_nibble_tables& _Tables) noexcept
+            : _Lo(_mm_load_si128(reinterpret_cast<const __m128i*>(_Tables._Lo))),
+              _Hi(_mm_load_si128(reinterpret_cast<const __m128i*>(_Tables._Hi))) {}
+
+        unsigned int _Match(const void* const _Chunk) const noexcept {
+            const __m128i _Bit_of_high_nibble =
+                _mm_set_epi8(-128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1);
+
+            const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_Chunk));
+            // pshufb yields zero where the index has its highest bit set,
+            // so each byte picks its row from _Lo or from _Hi, but not from both
+            const __m128i _Idx_lo = _mm_and_si128(_Data, _mm_set1_epi8(static_cast<char>(0x8F)));
+            const __m128i _Idx_hi = _mm_xor_si128(_Idx_lo, _mm_set1_epi8(static_cast<char>(0x80)));
+            const __m128i _Rows   = _mm_or_si128(_mm_shuffle_epi8(_Lo, _Idx_lo), _mm_shuffle_epi8(_Hi, _Idx_hi));
+            const __m128i _High   = _mm_and_si128(_mm_srli_epi16(_Data, 4), _mm_set1_epi8(0xF));
+            const __m128i _Found  = _mm_and_si128(_Rows, _mm_shuffle_epi8(_Bit_of_high_nibble, _High));
+            return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Found, _mm_setzero_si128()))) ^ 0xFFFF;
+        }
+    };
+
+    struct _Find_of_matcher_nibble_avx {
+        static constexpr size_t _Vec_size = 32;
+
+        __m256i _Lo;
+        __m256i _Hi;
+
+        explicit _Find_of_matcher_nibble_avx(const _Find_of_nibble_tables& _Tables) noexcept
+            : _Lo(_mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(_Tables._Lo)))),
+              _Hi(_mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(_Tables._Hi)))) {}
+
+        unsigned int _Match(const void* const _Chunk) const noexcept {
+            const __m256i _Bit_of_high_nibble = _mm256_set_epi8(-128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4,
+                2, 1, -128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1);
+
+            const __m256i _Data   = _mm256_loadu_si256(static_cast<const __m256i*>(_Chunk));
+            const __m256i _Idx_lo = _mm256_and_si256(_Data, _mm256_set1_epi8(static_cast<char>(0x8F)));
+            const __m256i _Idx_hi = _mm256_xor_si256(_Idx_lo, _mm256_set1_epi8(static_cast<char>(0x80)));
+            const __m256i _Rows =
+                _mm256_or_si256(_mm256_shuffle_epi8(_Lo, _Idx_lo), _mm256_shuffle_epi8(_Hi, _Idx_hi));
+            const __m256i _High  = _mm256_and_si256(_mm256_srli_epi16(_Data, 4), _mm256_set1_epi8(0xF));
+            const __m256i _Found = _mm256_and_si256(_Rows, _mm256_shuffle_epi8(_Bit_of_high_nibble, _High));
+            return ~static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_Found, _mm256_setzero_si256())));
+        }
+    };
+
+    // For 2-byte elements, pcmpestrm compares 8 haystack elements with 8 needle elements at once.
+    struct _Find_of_matcher_pcmpestrm_2 {
+        static constexpr size_t _Vec_size = 16;
+        static constexpr int _Op          = _SIDD_UWORD_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_UNIT_MASK;
+
+        const void* _Needle;
+        size_t _Needle_full_parts; // the number of complete 8-element parts of the needle
+        __m128i _Needle_tail; // the remaining elements of the needle
+        int _Needle_tail_length;
+
+        _Find_of_matcher_pcmpestrm_2(const void* const _First, const size_t _Count) noexcept
+            : _Needle(_First), _Needle_full_parts(_Count / 8), _Needle_tail(_mm_setzero_si128()),
+              _Needle_tail_length(static_cast<int>(_Count % 8)) {
+            if (_Needle_tail_length != 0) {
+                memcpy(&_Needle_tail, static_cast<const uint16_t*>(_First) + _Needle_full_parts * 8,
+                    static_cast<size_t>(_Needle_tail_length) * 2);
+            }
+        }
+
+        unsigned int _Match(const void* const _Chunk) const noexcept {
+            const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_Chunk));
+            __m128i _Found      = _mm_setzero_si128();
+
+            const void* _Part = _Needle;
+            for (size_t _Idx = 0; _Idx != _Needle_full_parts; ++_Idx) {
+                const __m128i _Part_data = _mm_loadu_si128(static_cast<const __m128i*>(_Part));
+                _Found                   = _mm_or_si128(_Found, _mm_cmpestrm(_Part_data, 8, _Data, 8, _Op));
+                _Advance_bytes(_Part, 16);
+            }
+
+            if (_Needle_tail_length != 0) {
+                _Found = _mm_or_si128(_Found, _mm_cmpestrm(_Needle_tail, _Needle_tail_length, _Data, 8, _Op));
+            }
+
+            return static_cast<unsigned int>(_mm_movemask_epi8(_Found));
+        }
+    };
+
+    // For wider elements, each needle element is broadcast and compared in turn.
+    template <class _Traits, class _Ty>
+    struct _Find_of_matcher_broadcast_sse {
+        static constexpr size_t _Vec_size = 16;
+
+        const _Ty* _Needle;
+        size_t _Needle_length;
+
+        unsigned int _Match(const void* const _Chunk) const noexcept {
+            const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_Chunk));
+            __m128i _Found      = _mm_setzero_si128();
+            for (size_t _Idx = 0; _Idx != _Needle_length; ++_Idx) {
+                _Found = _mm_or_si128(_Found, _Traits::_Cmp_sse(_Data, _Traits::_Set_sse(_Needle[_Idx])));
+            }
+
+            return static_cast<unsigned int>(_mm_movemask_epi8(_Found));
+        }
+    };
+
+    template <class _Traits, class _Ty>
+    struct _Find_of_matcher_broadcast_avx {
+        static constexpr size_t _Vec_size = 32;
+
+        const _Ty* _Needle;
+        size_t _Needle_length;
+
+        unsigned int _Match(const void* const _Chunk) const noexcept {
+            const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_Chunk));
+            __m256i _Found      = _mm256_setzero_si256();
+            for (size_t _Idx = 0; _Idx != _Needle_length; ++_Idx) {
+                _Found = _mm256_or_si256(_Found, _Traits::_Cmp_avx(_Data, _Traits::_Set_avx(_Needle[_Idx])));
+            }
+
+            return static_cast<unsigned int>(_mm256_movemask_epi8(_Found));
+        }
+    };
+#endif // !_M_ARM64EC
+
+    template <_Find_of_mode _Mode>
+    size_t _Find_of_pos_1(const void* const _Haystack, const size_t _Haystack_length, const void* const _Needle,
+        const size_t _Needle_length) noexcept {
+        const auto _Needle_first = static_cast<const uint8_t*>(_Needle);
+        const auto _Needle_last  = _Needle_first + _Needle_length;
+#ifndef _M_ARM64EC
+        if (_Use_sse42()) { // for pshufb
+            const _Find_of_nibble_tables _Tables(_Needle_first, _Needle_last);
+            if (_Use_avx2()) {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+                return _Find_of_pos_vectorized<_Mode, uint8_t>(
+                    _Find_of_matcher_nibble_avx{_Tables}, _Haystack, _Haystack_length);
+            }
+
+            return _Find_of_pos_vectorized<_Mode, uint8_t>(
+                _Find_of_matcher_nibble_sse{_Tables}, _Haystack, _Haystack_length);
+        }
+#endif // !_M_ARM64EC
+
+        bool _In_needle[256] = {};
+        for (auto _Ptr = _Needle_first; _Ptr != _Needle_last; ++_Ptr) {
+            _In_needle[*_Ptr] = true;
+        }
+
+        return _Find_of_pos_scalar<_Mode>(static_cast<const uint8_t*>(_Haystack), _Haystack_length,
+            [&_In_needle](const uint8_t _Val) noexcept { return _In_needle[_Val]; });
+    }
+
+    template <_Find_of_mode _Mode>
+    size_t _Find_of_pos_2(const void* const _Haystack, const size_t _Haystack_length, const void* const _Needle,
+        const size_t _Needle_length) noexcept {
+#ifndef _M_ARM64EC
+        if (_Use_sse42()) {
+            return _Find_of_pos_vectorized<_Mode, uint16_t>(
+                _Find_of_matcher_pcmpestrm_2{_Needle, _Needle_length}, _Haystack, _Haystack_length);
+        }
+#endif // !_M_ARM64EC
+
+        return _Find_of_pos_linear<_Mode>(static_cast<const uint16_t*>(_Haystack), _Haystack_length,
+            static_cast<const uint16_t*>(_Needle), _Needle_length);
+    }
+
+    template <_Find_of_mode _Mode, class _Traits, class _Ty>
+    size_t _Find_of_pos_wide(const void* const _Haystack, const size_t _Haystack_length, const void* const _Needle,
+        const size_t _Needle_length) noexcept {
+        const auto _Needle_ptr = static_cast<const _Ty*>(_Needle);
+#ifndef _M_ARM64EC
+        if (_Use_avx2()) {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+            return _Find_of_pos_vectorized<_Mode, _Ty>(
+                _Find_of_matcher_broadcast_avx<_Traits, _Ty>{_Needle_ptr, _Needle_length}, _Haystack,
+                _Haystack_length);
+        }
+
+        if (_Traits::_Sse_available()) {
+            return _Find_of_pos_vectorized<_Mode, _Ty>(
+                _Find_of_matcher_broadcast_sse<_Traits, _Ty>{_Needle_ptr, _Needle_length}, _Haystack,
+                _Haystack_length);
+        }
+#endif // !_M_ARM64EC
+
+        return _Find_of_pos_linear<_Mode>(
+            static_cast<const _Ty*>(_Haystack), _Haystack_length, _Needle_ptr, _Needle_length);
+    }
+
+    template <class _Ty, class _Find_pos_fn>
+    const void* _Find_first_of_ptr(_Find_pos_fn _Find_pos, const void* const _First1, const void* const _Last1,
+        const void* const _First2, const void* const _Last2) noexcept {
+        const size_t _Pos = _Find_pos(
+            _First1, _Byte_length(_First1, _Last1) / sizeof(_Ty), _First2, _Byte_length(_First2, _Last2) / sizeof(_Ty));
+        if (_Pos == static_cast<size_t>(-1)) {
+            return _Last1;
+        }
+
+        return static_cast<const _Ty*>(_First1) + _Pos;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+const void* __stdcall __std_find_first_of_trivial_1(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    return _Find_first_of_ptr<uint8_t>(_Find_of_pos_1<_Mode_first_of>, _First1, _Last1, _First2, _Last2);
+}
+
+const void* __stdcall __std_find_first_of_trivial_2(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    return _Find_first_of_ptr<uint16_t>(_Find_of_pos_2<_Mode_first_of>, _First1, _Last1, _First2, _Last2);
+}
+
+const void* __stdcall __std_find_first_of_trivial_4(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    return _Find_first_of_ptr<uint32_t>(
+        _Find_of_pos_wide<_Mode_first_of, _Find_traits_4, uint32_t>, _First1, _Last1, _First2, _Last2);
+}
+
+const void* __stdcall __std_find_first_of_trivial_8(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    return _Find_first_of_ptr<uint64_t>(
+        _Find_of_pos_wide<_Mode_first_of, _Find_traits_8, uint64_t>, _First1, _Last1, _First2, _Last2);
+}
+
+__declspec(noalias) size_t __stdcall __std_find_last_of_trivial_pos_1(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_of_pos_1<_Mode_last_of>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+__declspec(noalias) size_t __stdcall __std_find_last_of_trivial_pos_2(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_of_pos_2<_Mode_last_of>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+__declspec(noalias) size_t __stdcall __std_find_first_not_of_trivial_pos_1(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_of_pos_1<_Mode_first_not_of>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+__declspec(noalias) size_t __stdcall __std_find_first_not_of_trivial_pos_2(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_of_pos_2<_Mode_first_not_of>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+__declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_1(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_of_pos_1<_Mode_last_not_of>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+__declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_2(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_of_pos_2<_Mode_last_not_of>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+} // extern "C"
+
+namespace {
+    template <class _Ty>
+    size_t __stdcall __std_mismatch_impl(
+        const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+        size_t _Result = 0;
+#ifndef _M_ARM64EC
+        // Elements are equal exactly when all their bytes are, so the vector part compares bytes regardless of _Ty;
+        // the first differing byte belongs to the first differing element.
+        const auto _First1_ch     = static_cast<const char*>(_First1);
+        const auto _First2_ch     = static_cast<const char*>(_First2);
+        const size_t _Count_bytes = _Count * sizeof(_Ty);
+
+        if (_Use_avx2()) {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            const size_t _Count_bytes_avx_full = _Count_bytes & ~size_t{0x1F};
+            for (; _Result != _Count_bytes_avx_full; _Result += 0x20) {
+                const __m256i _Elem1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_First1_ch + _Result));
+                const __m256i _Elem2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_First2_ch + _Result));
+                const __m256i _Eq    = _mm256_cmpeq_epi8(_Elem1, _Elem2);
+
+                const unsigned int _Bingo = ~static_cast<unsigned int>(_mm256_movemask_epi8(_Eq));
+                if (_Bingo != 0) {
+                    return (_Result + _tzcnt_u32(_Bingo)) / sizeof(_Ty);
+                }
+            }
+        }
+
+        if (_Use_sse2()) { // also handles the tail of the AVX2 loop
+            const size_t _Count_bytes_sse_full = _Count_bytes & ~size_t{0xF};
+            for (; _Result != _Count_bytes_sse_full; _Result += 0x10) {
+                const __m128i _Elem1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_First1_ch + _Result));
+                const __m128i _Elem2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_First2_ch + _Result));
+                const __m128i _Eq    = _mm_cmpeq_epi8(_Elem1, _Elem2);
+
+                const unsigned int _Bingo = static_cast<unsigned int>(_mm_movemask_epi8(_Eq)) ^ 0xFFFF;
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo); // lgtm [cpp/conditionallyuninitializedvariable]
+                    return (_Result + _Offset) / sizeof(_Ty);
+                }
+            }
+        }
+
+        _Result /= sizeof(_Ty);
+#endif // !_M_ARM64EC
+
+        const auto _First1_el = static_cast<const _Ty*>(_First1);
+        const auto _First2_el = static_cast<const _Ty*>(_First2);
+        for (; _Result != _Count; ++_Result) {
+            if (_First1_el[_Result] != _First2_el[_Result]) {
+                break;
+            }
+        }
+
+        return _Result;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) size_t __stdcall __std_mismatch_1(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return __std_mismatch_impl<uint8_t>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t __stdcall __std_mismatch_2(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return __std_mismatch_impl<uint16_t>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t __stdcall __std_mismatch_4(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return __std_mismatch_impl<uint32_t>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t __stdcall __std_mismatch_8(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return __std_mismatch_impl<uint64_t>(_First1, _First2, _Count);
+}
+
+} // extern "C"
+
+namespace {
+    // For each 8-bit mask of the elements to keep, the indices of these elements packed to the front, and their count.
+    // One table serves all element sizes: 2-byte elements are expanded to word indices, and 4-byte and 8-byte elements
+    // are compressed as dwords.
+    struct _Compress_tables_t {
+        uint8_t _Shuf[256][8];
+        uint8_t _Size[256];
+    };
+
+    constexpr _Compress_tables_t _Make_compress_tables() noexcept {
+        _Compress_tables_t _Result{};
+        for (unsigned int _Mask = 0; _Mask != 256; ++_Mask) {
+            uint8_t _Count = 0;
+            for (uint8_t _Idx = 0; _Idx != 8; ++_Idx) {
+                if ((_Mask & (1u << _Idx)) != 0) {
+                    _Result._Shuf[_Mask][_Count] = _Idx;
+                    ++_Count;
+                }
+            }
+
+            _Result._Size[_Mask] = _Count;
+        }
+
+        return _Result;
+    }
+
+    constexpr _Compress_tables_t _Compress_tables = _Make_compress_tables();
+
+    struct _Compress_traits_1 {
+        using _Ty = uint8_t;
+
+#ifndef _M_ARM64EC
+        static constexpr bool _Has_avx     = false;
+        static constexpr size_t _Sse_step  = 8; // masks have 8 bits, so only the low half of a vector is used
+        static constexpr size_t _Mask_unit = 1;
+
+        static __m128i _Load_sse(const void* const _Src) noexcept {
+            return _mm_loadl_epi64(static_cast<const __m128i*>(_Src));
+        }
+
+        static void _Store_sse(void* const _Dest, const __m128i _Val) noexcept {
+            _mm_storel_epi64(static_cast<__m128i*>(_Dest), _Val);
+        }
+
+        static __m128i _Set_sse(const _Ty _Val) noexcept {
+            return _mm_set1_epi8(static_cast<char>(_Val));
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi8(_Lhs, _Rhs);
+        }
+
+        // Elements of _Cur, each preceded by the previous one; the first is preceded by the last element of _Prev
+        static __m128i _Shift_in_sse(const __m128i _Prev, const __m128i _Cur) noexcept {
+            return _mm_alignr_epi8(_Cur, _mm_slli_si128(_Prev, 8), 15);
+        }
+
+        static unsigned int _Keep_mask_sse(const __m128i _Eq) noexcept {
+            return ~static_cast<unsigned int>(_mm_movemask_epi8(_Eq)) & 0xFF;
+        }
+
+        static __m128i _Compress_sse(const __m128i _Val, const unsigned int _Mask) noexcept {
+            const __m128i _Shuf = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_Compress_tables._Shuf[_Mask]));
+            return _mm_shuffle_epi8(_Val, _Shuf);
+        }
+#endif // !_M_ARM64EC
+    };
+
+    struct _Compress_traits_2 {
+        using _Ty = uint16_t;
+
+#ifndef _M_ARM64EC
+        static constexpr bool _Has_avx     = false;
+        static constexpr size_t _Sse_step  = 16;
+        static constexpr size_t _Mask_unit = 2;
+
+        static __m128i _Load_sse(const void* const _Src) noexcept {
+            return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
+        }
+
+        static void _Store_sse(void* const _Dest, const __m128i _Val) noexcept {
+            _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Val);
+        }
+
+        static __m128i _Set_sse(const _Ty _Val) noexcept {
+            return _mm_set1_epi16(static_cast<short>(_Val));
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi16(_Lhs, _Rhs);
+        }
+
+        static __m128i _Shift_in_sse(const __m128i _Prev, const __m128i _Cur) noexcept {
+            return _mm_alignr_epi8(_Cur, _Prev, 14);
+        }
+
+        static unsigned int _Keep_mask_sse(const __m128i _Eq) noexcept {
+            return ~static_cast<unsigned int>(_mm_movemask_epi8(_mm_packs_epi16(_Eq, _mm_setzero_si128()))) & 0xFF;
+        }
+
+        static __m128i _Compress_sse(const __m128i _Val, const unsigned int _Mask) noexcept {
+            // word index i becomes the byte indices 2 * i and 2 * i + 1
+            const __m128i _Idx = _mm_cvtepu8_epi16(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_Compress_tables._Shuf[_Mask])));
+            const __m128i _Shuf = _mm_add_epi16(_mm_mullo_epi16(_Idx, _mm_set1_epi16(0x0202)), _mm_set1_epi16(0x0100));
+            return _mm_shuffle_epi8(_Val, _Shuf);
+        }
+#endif // !_M_ARM64EC
+    };
+
+    struct _Compress_traits_4 {
+        using _Ty = uint32_t;
+
+#ifndef _M_ARM64EC
+        static constexpr bool _Has_avx     = true;
+        static constexpr size_t _Sse_step  = 16;
+        static constexpr size_t _Mask_unit = 4;
+
+        static __m128i _Load_sse(const void* const _Src) noexcept {
+            return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
+        }
+
+        static void _Store_sse(void* const _Dest, const __m128i _Val) noexcept {
+            _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Val);
+        }
+
+        static __m128i _Set_sse(const _Ty _Val) noexcept {
+            return _mm_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi32(_Lhs, _Rhs);
+        }
+
+        static __m128i _Shift_in_sse(const __m128i _Prev, const __m128i _Cur) noexcept {
+            return _mm_alignr_epi8(_Cur, _Prev, 12);
+        }
+
+        static unsigned int _Keep_mask_sse(const __m128i _Eq) noexcept {
+            return ~static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_Eq))) & 0xF;
+        }
+
+        static __m128i _Compress_sse(const __m128i _Val, const unsigned int _Mask) noexcept {
+            // dword index i becomes the byte indices 4 * i to 4 * i + 3
+            const __m128i _Idx = _mm_cvtepu8_epi32(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_Compress_tables._Shuf[_Mask])));
+            const __m128i _Shuf =
+                _mm_add_epi32(_mm_mullo_epi32(_Idx, _mm_set1_epi32(0x0404'0404)), _mm_set1_epi32(0x0302'0100));
+            return _mm_shuffle_epi8(_Val, _Shuf);
+        }
+
+        static __m256i _Set_avx(const _Ty _Val) noexcept {
+            return _mm256_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi32(_Lhs, _Rhs);
+        }
+
+        static __m256i _Shift_in_avx(const __m256i _Prev, const __m256i _Cur) noexcept {
+            return _mm256_alignr_epi8(_Cur, _mm256_permute2x128_si256(_Prev, _Cur, 0x21), 12);
+        }
+
+        static unsigned int _Keep_mask_avx(const __m256i _Eq) noexcept {
+            return ~static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_Eq))) & 0xFF;
+        }
+
+        static __m256i _Compress_avx(const __m256i _Val, const unsigned int _Mask) noexcept {
+            const __m256i _Idx = _mm256_cvtepu8_epi32(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_Compress_tables._Shuf[_Mask])));
+            return _mm256_permutevar8x32_epi32(_Val, _Idx);
+        }
+#endif // !_M_ARM64EC
+    };
+
+    // 8-byte elements are compressed as pairs of dwords: each of them sets two adjacent bits in the masks
+    struct _Compress_traits_8 : _Compress_traits_4 {
+        using _Ty = uint64_t;
+
+#ifndef _M_ARM64EC
+        static __m128i _Set_sse(const _Ty _Val) noexcept {
+            return _mm_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi64(_Lhs, _Rhs);
+        }
+
+        static __m128i _Shift_in_sse(const __m128i _Prev, const __m128i _Cur) noexcept {
+            return _mm_alignr_epi8(_Cur, _Prev, 8);
+        }
+
+        static __m256i _Set_avx(const _Ty _Val) noexcept {
+            return _mm256_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi64(_Lhs, _Rhs);
+        }
+
+        static __m256i _Shift_in_avx(const __m256i _Prev, const __m256i _Cur) noexcept {
+            return _mm256_alignr_epi8(_Cur, _mm256_permute2x128_si256(_Prev, _Cur, 0x21), 8);
+        }
+#endif // !_M_ARM64EC
+    };
+
+    enum _Compress_mode { _Compress_remove, _Compress_unique };
+
+    // Keeps the elements of [_First, _Last) that are not equal to _Cmp, writing them to _Dest, and returns the end of
+    // the output. For _Compress_remove, _Cmp is the value to remove. For _Compress_unique, it is the previous element,
+    // the one before _First initially.
+    // In place (not _Copy), _Dest is never ahead of _First, and whole vectors are stored: they may only overwrite
+    // the portion just loaded, so for _Compress_unique the previous element is taken from the vector, not from memory.
+    // Otherwise, the kept elements are copied out of a buffer, as _Dest may have no room for whole vectors.
+    template <class _Traits, _Compress_mode _Mode, bool _Copy>
+    void* _Compress(const void* _First, const void* const _Last, void* _Dest, typename _Traits::_Ty _Cmp) noexcept {
+        using _Ty = _Traits::_Ty;
+
+#ifndef _M_ARM64EC
+        if constexpr (_Traits::_Has_avx) {
+            const size_t _Size_bytes = _Byte_length(_First, _Last);
+            if (_Size_bytes >= 32 && _Use_avx2()) {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+                const void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+
+                __m256i _Cmp_vec = _Traits::_Set_avx(_Cmp); // for _Compress_unique, the previous portion
+                do {
+                    const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                    unsigned int _Keep;
+                    if constexpr (_Mode == _Compress_remove) {
+                        _Keep = _Traits::_Keep_mask_avx(_Traits::_Cmp_avx(_Data, _Cmp_vec));
+                    } else {
+                        const __m256i _Prev = _Traits::_Shift_in_avx(_Cmp_vec, _Data);
+                        _Keep               = _Traits::_Keep_mask_avx(_Traits::_Cmp_avx(_Data, _Prev));
+                        _Cmp_vec            = _Data;
+                    }
+
+                    const __m256i _Kept    = _Traits::_Compress_avx(_Data, _Keep);
+                    const size_t _Kept_len = _Compress_tables._Size[_Keep] * _Traits::_Mask_unit;
+                    if constexpr (_Copy) {
+                        alignas(32) uint8_t _Buf[32];
+                        _mm256_store_si256(reinterpret_cast<__m256i*>(_Buf), _Kept);
+                        memcpy(_Dest, _Buf, _Kept_len);
+                    } else {
+                        _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Kept);
+                    }
+
+                    _Advance_bytes(_Dest, _Kept_len);
+                    _Advance_bytes(_First, 32);
+                } while (_First != _Stop_at);
+
+                if constexpr (_Mode == _Compress_unique) {
+                    alignas(32) _Ty _Elems[32 / sizeof(_Ty)];
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(_Elems), _Cmp_vec);
+                    _Cmp = _Elems[32 / sizeof(_Ty) - 1];
+                }
+            }
+        }
+
+        if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Size_bytes >= _Traits::_Sse_step && _Use_sse42()) {
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes - _Size_bytes % _Traits::_Sse_step);
+
+            __m128i _Cmp_vec = _Traits::_Set_sse(_Cmp); // for _Compress_unique, the previous portion
+            do {
+                const __m128i _Data = _Traits::_Load_sse(_First);
+                unsigned int _Keep;
+                if constexpr (_Mode == _Compress_remove) {
+                    _Keep = _Traits::_Keep_mask_sse(_Traits::_Cmp_sse(_Data, _Cmp_vec));
+                } else {
+                    const __m128i _Prev = _Traits::_Shift_in_sse(_Cmp_vec, _Data);
+                    _Keep               = _Traits::_Keep_mask_sse(_Traits::_Cmp_sse(_Data, _Prev));
+                    _Cmp_vec            = _Data;
+                }
+
+                const __m128i _Kept    = _Traits::_Compress_sse(_Data, _Keep);
+                const size_t _Kept_len = _Compress_tables._Size[_Keep] * _Traits::_Mask_unit;
+                if constexpr (_Copy) {
+                    alignas(16) uint8_t _Buf[16];
+                    _mm_store_si128(reinterpret_cast<__m128i*>(_Buf), _Kept);
+                    memcpy(_Dest, _Buf, _Kept_len);
+                } else {
+                    _Traits::_Store_sse(_Dest, _Kept);
+                }
+
+                _Advance_bytes(_Dest, _Kept_len);
+                _Advance_bytes(_First, _Traits::_Sse_step);
+            } while (_First != _Stop_at);
+
+            if constexpr (_Mode == _Compress_unique) {
+                alignas(16) _Ty _Elems[16 / sizeof(_Ty)];
+                _mm_store_si128(reinterpret_cast<__m128i*>(_Elems), _Cmp_vec);
+                _Cmp = _Elems[_Traits::_Sse_step / sizeof(_Ty) - 1];
+            }
+        }
+#endif // !_M_ARM64EC
+
+        auto _Out = static_cast<_Ty*>(_Dest);
+        for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            const _Ty _Val = *_Ptr;
+            if (_Val != _Cmp) {
+                *_Out = _Val;
+                ++_Out;
+            }
+
+            if constexpr (_Mode == _Compress_unique) {
+                _Cmp = _Val;
+            }
+        }
+
+        return _Out;
+    }
+
+    template <class _Traits, bool _Copy>
+    void* _Unique_impl(const void* _First, const void* const _Last, void* _Dest) noexcept {
+        using _Ty = _Traits::_Ty;
+
+        if (_First == _Last) {
+            return _Dest;
+        }
+
+        // The first element is always kept; in place, it is already there
+        const _Ty _Val = *static_cast<const _Ty*>(_First);
+        if constexpr (_Copy) {
+            *static_cast<_Ty*>(_Dest) = _Val;
+        }
+
+        _Advance_bytes(_First, sizeof(_Ty));
+        _Advance_bytes(_Dest, sizeof(_Ty));
+        return _Compress<_Traits, _Compress_unique, _Copy>(_First, _Last, _Dest, _Val);
+    }
+} // unnamed namespace
+
+extern "C" {
+
+void* __stdcall __std_remove_1(void* const _First, void* const _Last, const uint8_t _Val) noexcept {
+    return _Compress<_Compress_traits_1, _Compress_remove, false>(_First, _Last, _First, _Val);
+}
+
+void* __stdcall __std_remove_2(void* const _First, void* const _Last, const uint16_t _Val) noexcept {
+    return _Compress<_Compress_traits_2, _Compress_remove, false>(_First, _Last, _First, _Val);
+}
+
+void* __stdcall __std_remove_4(void* const _First, void* const _Last, const uint32_t _Val) noexcept {
+    return _Compress<_Compress_traits_4, _Compress_remove, false>(_First, _Last, _First, _Val);
+}
+
+void* __stdcall __std_remove_8(void* const _First, void* const _Last, const uint64_t _Val) noexcept {
+    return _Compress<_Compress_traits_8, _Compress_remove, false>(_First, _Last, _First, _Val);
+}
+
+void* __stdcall __std_remove_copy_1(
+    const void* const _First, const void* const _Last, void* const _Dest, const uint8_t _Val) noexcept {
+    return _Compress<_Compress_traits_1, _Compress_remove, true>(_First, _Last, _Dest, _Val);
+}
+
+void* __stdcall __std_remove_copy_2(
+    const void* const _First, const void* const _Last, void* const _Dest, const uint16_t _Val) noexcept {
+    return _Compress<_Compress_traits_2, _Compress_remove, true>(_First, _Last, _Dest, _Val);
+}
+
+void* __stdcall __std_remove_copy_4(
+    const void* const _First, const void* const _Last, void* const _Dest, const uint32_t _Val) noexcept {
+    return _Compress<_Compress_traits_4, _Compress_remove, true>(_First, _Last, _Dest, _Val);
+}
+
+void* __stdcall __std_remove_copy_8(
+    const void* const _First, const void* const _Last, void* const _Dest, const uint64_t _Val) noexcept {
+    return _Compress<_Compress_traits_8, _Compress_remove, true>(_First, _Last, _Dest, _Val);
+}
+
+void* __stdcall __std_unique_1(void* const _First, void* const _Last) noexcept {
+    return _Unique_impl<_Compress_traits_1, false>(_First, _Last, _First);
+}
+
+void* __stdcall __std_unique_2(void* const _First, void* const _Last) noexcept {
+    return _Unique_impl<_Compress_traits_2, false>(_First, _Last, _First);
+}
+
+void* __stdcall __std_unique_4(void* const _First, void* const _Last) noexcept {
+    return _Unique_impl<_Compress_traits_4, false>(_First, _Last, _First);
+}
+
+void* __stdcall __std_unique_8(void* const _First, void* const _Last) noexcept {
+    return _Unique_impl<_Compress_traits_8, false>(_First, _Last, _First);
+}
+
+void* __stdcall __std_unique_copy_1(const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    return _Unique_impl<_Compress_traits_1, true>(_First, _Last, _Dest);
+}
+
+void* __stdcall __std_unique_copy_2(const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    return _Unique_impl<_Compress_traits_2, true>(_First, _Last, _Dest);
+}
+
+void* __stdcall __std_unique_copy_4(const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    return _Unique_impl<_Compress_traits_4, true>(_First, _Last, _Dest);
+}
+
+void* __stdcall __std_unique_copy_8(const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    return _Unique_impl<_Compress_traits_8, true>(_First, _Last, _Dest);
+}
+
+} // extern "C"
+
+namespace {
+#ifndef _M_ARM64EC
+    // Fills larger than this bypass the cache with non-temporal stores; a destination this big would evict
+    // the cache anyway, and streaming avoids reading each line just to overwrite it.
+    constexpr size_t _Fill_streaming_threshold = size_t{1} << 22;
+#endif // !_M_ARM64EC
+
+    template <class _Traits, class _Ty>
+    void __stdcall _Fill_impl(void* _First, const size_t _Count, const _Ty _Val) noexcept {
+        size_t _Size_bytes = _Count * sizeof(_Ty);
+#ifndef _M_ARM64EC
+        if (_Size_bytes >= 32 && _Use_avx2()) {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            const __m256i _Pattern = _Traits::_Set_avx(_Val);
+            void* _Last            = _First;
+            _Advance_bytes(_Last, _Size_bytes);
+
+            if (_Size_bytes >= _Fill_streaming_threshold && reinterpret_cast<uintptr_t>(_First) % sizeof(_Ty) == 0) {
+                // The element aligned destination keeps the pattern in phase with the 32-byte boundary
+                _mm256_storeu_si256(static_cast<__m256i*>(_First), _Pattern);
+                const size_t _Head = 0x20 - (reinterpret_cast<uintptr_t>(_First) & 0x1F);
+                _Advance_bytes(_First, _Head);
+                _Size_bytes -= _Head;
+
+                void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+                do {
+                    _mm256_stream_si256(static_cast<__m256i*>(_First), _Pattern);
+                    _Advance_bytes(_First, 32);
+                } while (_First != _Stop_at);
+                _mm_sfence();
+            } else {
+                void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+                do {
+                    _mm256_storeu_si256(static_cast<__m256i*>(_First), _Pattern);
+                    _Advance_bytes(_First, 32);
+                } while (_First != _Stop_at);
+            }
+
+            if ((_Size_bytes & 0x1F) != 0) {
+                // The tail is a whole number of elements, so the last full vector ends in phase with the pattern
+                _Rewind_bytes(_Last, 32);
+                _mm256_storeu_si256(static_cast<__m256i*>(_Last), _Pattern);
+            }
+
+            return;
+        }
+
+        if (_Size_bytes >= 16 && _Use_sse2()) {
+            const __m128i _Pattern = _Traits::_Set_sse(_Val);
+            void* _Last            = _First;
+            _Advance_bytes(_Last, _Size_bytes);
+
+            if (_Size_bytes >= _Fill_streaming_threshold && reinterpret_cast<uintptr_t>(_First) % sizeof(_Ty) == 0) {
+                _mm_storeu_si128(static_cast<__m128i*>(_First), _Pattern);
+                const size_t _Head = 0x10 - (reinterpret_cast<uintptr_t>(_First) & 0xF);
+                _Advance_bytes(_First, _Head);
+                _Size_bytes -= _Head;
+
+                void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0xF});
+                do {
+                    _mm_stream_si128(static_cast<__m128i*>(_First), _Pattern);
+                    _Advance_bytes(_First, 16);
+                } while (_First != _Stop_at);
+                _mm_sfence();
+            } else {
+                void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0xF});
+                do {
+                    _mm_storeu_si128(static_cast<__m128i*>(_First), _Pattern);
+                    _Advance_bytes(_First, 16);
+                } while (_First != _Stop_at);
+            }
+
+            if ((_Size_bytes & 0xF) != 0) {
+                _Rewind_bytes(_Last, 16);
+                _mm_storeu_si128(static_cast<__m128i*>(_Last), _Pattern);
+            }
+
+            return;
+        }
+#endif // !_M_ARM64EC
+
+        auto _Ptr = static_cast<_Ty*>(_First);
+        for (; _Size_bytes != 0; _Size_bytes -= sizeof(_Ty)) {
+            *_Ptr++ = _Val;
+        }
+    }
+
+#ifndef _M_ARM64EC
+    template <class _Ty>
+    void _Replace_matched(void* const _First, unsigned int _Bingo, const _Ty _New_val) noexcept {
+        // _Bingo has a bit for every byte of a matched element; keep the bit of its first byte
+        _Bingo &= 0xFFFF'FFFFu / ((1u << sizeof(_Ty)) - 1);
+        while (_Bingo != 0) {
+            unsigned long _Offset;
+            _BitScanForward(&_Offset, _Bingo); // lgtm [cpp/conditionallyuninitializedvariable]
+            static_cast<_Ty*>(_First)[_Offset / sizeof(_Ty)] = _New_val;
+            _Bingo &= _Bingo - 1;
+        }
+    }
+#endif // !_M_ARM64EC
+
+    template <class _Traits, class _Ty>
+    void __stdcall _Replace_impl(void* _First, void* const _Last, const _Ty _Old_val, const _Ty _New_val) noexcept {
+#ifndef _M_ARM64EC
+        // Only the matched elements are written, as by the scalar loop
+        size_t _Size_bytes = _Byte_length(_First, _Last);
+
+        const size_t _Avx_size = _Size_bytes & ~size_t{0x1F};
+        if (_Avx_size != 0 && _Use_avx2()) {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            const __m256i _Comparand   = _Traits::_Set_avx(_Old_val);
+            const __m256i _Replacement = _Traits::_Set_avx(_New_val);
+            void* _Stop_at             = _First;
+            _Advance_bytes(_Stop_at, _Avx_size);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                const __m256i _Mask = _Traits::_Cmp_avx(_Data, _Comparand);
+                if constexpr (sizeof(_Ty) >= 4) {
+                    // Stores are masked by dword, which also covers a matched qword
+                    _mm256_maskstore_epi32(static_cast<int*>(_First), _Mask, _Replacement);
+                } else {
+                    _Replace_matched(_First, static_cast<unsigned int>(_mm256_movemask_epi8(_Mask)), _New_val);
+                }
+
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+            _Size_bytes &= 0x1F;
+        }
+
+        const size_t _Sse_size = _Size_bytes & ~size_t{0xF};
+        if (_Sse_size != 0 && _Traits::_Sse_available()) {
+            const __m128i _Comparand = _Traits::_Set_sse(_Old_val);
+            void* _Stop_at           = _First;
+            _Advance_bytes(_Stop_at, _Sse_size);
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
+                _Replace_matched(_First, static_cast<unsigned int>(_Bingo), _New_val);
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+#endif // !_M_ARM64EC
+
+        for (auto _Ptr = static_cast<_Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            if (*_Ptr == _Old_val) {
+                *_Ptr = _New_val;
+            }
+        }
+    }
+
+    template <class _Traits, class _Ty>
+    void* __stdcall _Replace_copy_impl(const void* _First, const void* const _Last, void* _Dest, const _Ty _Old_val,
+        const _Ty _New_val) noexcept {
+#ifndef _M_ARM64EC
+        size_t _Size_bytes = _Byte_length(_First, _Last);
+
+        const size_t _Avx_size = _Size_bytes & ~size_t{0x1F};
+        if (_Avx_size != 0 && _Use_avx2()) {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            const __m256i _Comparand   = _Traits::_Set_avx(_Old_val);
+            const __m256i _Replacement = _Traits::_Set_avx(_New_val);
+            const void* _Stop_at       = _First;
+            _Advance_bytes(_Stop_at, _Avx_size);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                const __m256i _Mask = _Traits::_Cmp_avx(_Data, _Comparand);
+                _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _mm256_blendv_epi8(_Data, _Replacement, _Mask));
+                _Advance_bytes(_First, 32);
+                _Advance_bytes(_Dest, 32);
+            } while (_First != _Stop_at);
+            _Size_bytes &= 0x1F;
+        }
+
+        const size_t _Sse_size = _Size_bytes & ~size_t{0xF};
+        if (_Sse_size != 0 && _Use_sse42()) { // for pblendvb, and pcmpeqq on _Cmp_sse
+            const __m128i _Comparand   = _Traits::_Set_sse(_Old_val);
+            const __m128i _Replacement = _Traits::_Set_sse(_New_val);
+            const void* _Stop_at       = _First;
+            _Advance_bytes(_Stop_at, _Sse_size);
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                const __m128i _Mask = _Traits::_Cmp_sse(_Data, _Comparand);
+                _mm_storeu_si128(static_cast<__m128i*>(_Dest), _mm_blendv_epi8(_Data, _Replacement, _Mask));
+                _Advance_bytes(_First, 16);
+                _Advance_bytes(_Dest, 16);
+            } while (_First != _Stop_at);
+        }
+#endif // !_M_ARM64EC
+
+        auto _Dest_ptr = static_cast<_Ty*>(_Dest);
+        for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr, ++_Dest_ptr) {
+            *_Dest_ptr = *_Ptr == _Old_val ? _New_val : *_Ptr;
+        }
+
+        return _Dest_ptr;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) void __stdcall __std_fill_2(void* const _First, const size_t _Count, const uint16_t _Val) noexcept {
+    _Fill_impl<_Find_traits_2>(_First, _Count, _Val);
+}
+
+__declspec(noalias) void __stdcall __std_fill_4(void* const _First, const size_t _Count, const uint32_t _Val) noexcept {
+    _Fill_impl<_Find_traits_4>(_First, _Count, _Val);
+}
+
+__declspec(noalias) void __stdcall __std_fill_8(void* const _First, const size_t _Count, const uint64_t _Val) noexcept {
+    _Fill_impl<_Find_traits_8>(_First, _Count, _Val);
+}
+
+__declspec(noalias) void __stdcall __std_replace_1(
+    void* const _First, void* const _Last, const uint8_t _Old_val, const uint8_t _New_val) noexcept {
+    _Replace_impl<_Find_traits_1>(_First, _Last, _Old_val, _New_val);
+}
+
+__declspec(noalias) void __stdcall __std_replace_2(
+    void* const _First, void* const _Last, const uint16_t _Old_val, const uint16_t _New_val) noexcept {
+    _Replace_impl<_Find_traits_2>(_First, _Last, _Old_val, _New_val);
+}
+
+__declspec(noalias) void __stdcall __std_replace_4(
+    void* const _First, void* const _Last, const uint32_t _Old_val, const uint32_t _New_val) noexcept {
+    _Replace_impl<_Find_traits_4>(_First, _Last, _Old_val, _New_val);
+}
+
+__declspec(noalias) void __stdcall __std_replace_8(
+    void* const _First, void* const _Last, const uint64_t _Old_val, const uint64_t _New_val) noexcept {
+    _Replace_impl<_Find_traits_8>(_First, _Last, _Old_val, _New_val);
+}
+
+void* __stdcall __std_replace_copy_1(const void* const _First, const void* const _Last, void* const _Dest,
+    const uint8_t _Old_val, const uint8_t _New_val) noexcept {
+    return _Replace_copy_impl<_Find_traits_1>(_First, _Last, _Dest, _Old_val, _New_val);
+}
+
+void* __stdcall __std_replace_copy_2(const void* const _First, const void* const _Last, void* const _Dest,
+    const uint16_t _Old_val, const uint16_t _New_val) noexcept {
+    return _Replace_copy_impl<_Find_traits_2>(_First, _Last, _Dest, _Old_val, _New_val);
+}
+
+void* __stdcall __std_replace_copy_4(const void* const _First, const void* const _Last, void* const _Dest,
+    const uint32_t _Old_val, const uint32_t _New_val) noexcept {
+    return _Replace_copy_impl<_Find_traits_4>(_First, _Last, _Dest, _Old_val, _New_val);
+}
+
+void* __stdcall __std_replace_copy_8(const void* const _First, const void* const _Last, void* const _Dest,
+    const uint64_t _Old_val, const uint64_t _New_val) noexcept {
+    return _Replace_copy_impl<_Find_traits_8>(_First, _Last, _Dest, _Old_val, _New_val);
+}
+
+} // extern "C"
+
+namespace {
+#ifndef _M_ARM64EC
+    __m128i _Bitset_to_string_step(const uint16_t _Val) noexcept {
+        // Spreads the bits to bytes, most significant first, then sets the bytes of set bits to 0xFF
+        const __m128i _Shuf = _mm_set_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1);
+        const __m128i _Mask = _mm_set_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+        const __m128i _Ex   = _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _Shuf); // SSSE3
+        return _mm_cmpeq_epi8(_mm_and_si128(_Ex, _Mask), _Mask);
+    }
+
+    __m256i _Bitset_to_string_step_avx(const uint32_t _Val) noexcept {
+        const __m256i _Shuf = _mm256_set_epi8( //
+            0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, //
+            2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+        const __m256i _Mask = _mm256_set_epi8( //
+            1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, //
+            1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+        const __m256i _Ex = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(_Val)), _Shuf);
+        return _mm256_cmpeq_epi8(_mm256_and_si256(_Ex, _Mask), _Mask);
+    }
+#endif // !_M_ARM64EC
+
+    template <class _Elem>
+    void __stdcall _Bitset_to_string(_Elem* const _Dest, const void* const _Src, const size_t _Size_bits,
+        const _Elem _Elem0, const _Elem _Elem1) noexcept {
+        // The last character is bit 0; _Pos counts the bits done, starting from it
+        const auto _Src_bytes = static_cast<const unsigned char*>(_Src);
+        size_t _Pos           = 0;
+#ifndef _M_ARM64EC
+        if (_Size_bits >= 32 && _Use_avx2()) {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            if constexpr (sizeof(_Elem) == 1) {
+                const __m256i _Px0 = _mm256_set1_epi8(_Elem0);
+                const __m256i _Px1 = _mm256_set1_epi8(_Elem1);
+                for (; _Size_bits - _Pos >= 32; _Pos += 32) {
+                    uint32_t _Val;
+                    memcpy(&_Val, _Src_bytes + _Pos / 8, sizeof(_Val));
+                    const __m256i _Chars = _mm256_blendv_epi8(_Px0, _Px1, _Bitset_to_string_step_avx(_Val));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest + (_Size_bits - _Pos - 32)), _Chars);
+                }
+            } else {
+                const __m256i _Px0 = _mm256_set1_epi16(static_cast<short>(_Elem0));
+                const __m256i _Px1 = _mm256_set1_epi16(static_cast<short>(_Elem1));
+                for (; _Size_bits - _Pos >= 16; _Pos += 16) {
+                    uint16_t _Val;
+                    memcpy(&_Val, _Src_bytes + _Pos / 8, sizeof(_Val));
+                    const __m256i _Ex    = _mm256_cvtepi8_epi16(_Bitset_to_string_step(_Val));
+                    const __m256i _Chars = _mm256_blendv_epi8(_Px0, _Px1, _Ex);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest + (_Size_bits - _Pos - 16)), _Chars);
+                }
+            }
+        }
+
+        if (_Size_bits - _Pos >= 16 && _Use_sse42()) { // for pshufb and pblendvb
+            if constexpr (sizeof(_Elem) == 1) {
+                const __m128i _Px0 = _mm_set1_epi8(_Elem0);
+                const __m128i _Px1 = _mm_set1_epi8(_Elem1);
+                for (; _Size_bits - _Pos >= 16; _Pos += 16) {
+                    uint16_t _Val;
+                    memcpy(&_Val, _Src_bytes + _Pos / 8, sizeof(_Val));
+                    const __m128i _Chars = _mm_blendv_epi8(_Px0, _Px1, _Bitset_to_string_step(_Val));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest + (_Size_bits - _Pos - 16)), _Chars);
+                }
+            } else {
+                const __m128i _Px0 = _mm_set1_epi16(static_cast<short>(_Elem0));
+                const __m128i _Px1 = _mm_set1_epi16(static_cast<short>(_Elem1));
+                for (; _Size_bits - _Pos >= 16; _Pos += 16) {
+                    uint16_t _Val;
+                    memcpy(&_Val, _Src_bytes + _Pos / 8, sizeof(_Val));
+                    const __m128i _Ex     = _Bitset_to_string_step(_Val);
+                    const __m128i _Chars1 = _mm_blendv_epi8(_Px0, _Px1, _mm_unpacklo_epi8(_Ex, _Ex));
+                    const __m128i _Chars2 = _mm_blendv_epi8(_Px0, _Px1, _mm_unpackhi_epi8(_Ex, _Ex));
+                    _Elem* const _Block   = _Dest + (_Size_bits - _Pos - 16);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(_Block), _Chars1);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(_Block + 8), _Chars2);
+                }
+            }
+        }
+#endif // !_M_ARM64EC
+
+        for (; _Pos != _Size_bits; ++_Pos) {
+            _Dest[_Size_bits - 1 - _Pos] = ((_Src_bytes[_Pos / 8] >> (_Pos % 8)) & 1) != 0 ? _Elem1 : _Elem0;
+        }
+    }
+
+    struct _Bitset_from_string_traits_1 {
+#ifndef _M_ARM64EC
+        static __m128i _Set_sse(const char _Val) noexcept {
+            return _mm_set1_epi8(_Val);
+        }
+
+        static __m128i _Cmp_sse(const char* const _Src, const __m128i _Val) noexcept {
+            // 16 characters to 16 bytes, 0xFF where equal to _Val
+            return _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src)), _Val);
+        }
+
+        static __m256i _Set_avx(const char _Val) noexcept {
+            return _mm256_set1_epi8(_Val);
+        }
+
+        static __m256i _Cmp_avx(const char* const _Src, const __m256i _Val) noexcept {
+            // 32 characters to 32 bytes, 0xFF where equal to _Val
+            return _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src)), _Val);
+        }
+#endif // !_M_ARM64EC
+    };
+
+    struct _Bitset_from_string_traits_2 {
+#ifndef _M_ARM64EC
+        static __m128i _Set_sse(const wchar_t _Val) noexcept {
+            return _mm_set1_epi16(static_cast<short>(_Val));
+        }
+
+        static __m128i _Cmp_sse(const wchar_t* const _Src, const __m128i _Val) noexcept {
+            const __m128i _Eq_lo = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src)), _Val);
+            const __m128i _Eq_hi = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + 8)), _Val);
+            return _mm_packs_epi16(_Eq_lo, _Eq_hi);
+        }
+
+        static __m256i _Set_avx(const wchar_t _Val) noexcept {
+            return _mm256_set1_epi16(static_cast<short>(_Val));
+        }
+
+        static __m256i _Cmp_avx(const wchar_t* const _Src, const __m256i _Val) noexcept {
+            const __m256i _Eq_lo =
+                _mm256_cmpeq_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src)), _Val);
+            const __m256i _Eq_hi =
+                _mm256_cmpeq_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src + 16)), _Val);
+            // packs works within lanes; restore the character order
+            return _mm256_permute4x64_epi64(_mm256_packs_epi16(_Eq_lo, _Eq_hi), _MM_SHUFFLE(3, 1, 2, 0));
+        }
+#endif // !_M_ARM64EC
+    };
+
+    template <class _Traits, class _Elem>
+    bool __stdcall _Bitset_from_string(void* const _Dest, const _Elem* const _Src, const size_t _Size_bytes,
+        const size_t _Size_bits, const size_t _Size_chars, const _Elem _Elem0, const _Elem _Elem1) noexcept {
+        // Characters past the first _Size_bits are only validated
+        for (size_t _Idx = _Size_bits; _Idx < _Size_chars; ++_Idx) {
+            if (_Src[_Idx] != _Elem0 && _Src[_Idx] != _Elem1) {
+                return false;
+            }
+        }
+
+        memset(_Dest, 0, _Size_bytes);
+
+        // The last converted character is bit 0; _Pos counts the bits done, starting from it
+        const size_t _Size_convert = _Size_chars < _Size_bits ? _Size_chars : _Size_bits;
+        const auto _Dest_bytes     = static_cast<unsigned char*>(_Dest);
+        size_t _Pos                = 0;
+#ifndef _M_ARM64EC
+        if (_Size_convert >= 32 && _Use_avx2()) {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            const __m256i _Reverse = _mm256_set_epi8( //
+                0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, //
+                0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            const __m256i _Px0 = _Traits::_Set_avx(_Elem0);
+            const __m256i _Px1 = _Traits::_Set_avx(_Elem1);
+            for (; _Size_convert - _Pos >= 32; _Pos += 32) {
+                const _Elem* const _Block = _Src + (_Size_convert - _Pos - 32);
+                const __m256i _Eq1        = _Traits::_Cmp_avx(_Block, _Px1);
+                const __m256i _Eq0        = _Traits::_Cmp_avx(_Block, _Px0);
+                if (_mm256_movemask_epi8(_mm256_or_si256(_Eq0, _Eq1)) != -1) {
+                    return false;
+                }
+
+                const __m256i _Rev = _mm256_permute4x64_epi64(
+                    _mm256_shuffle_epi8(_Eq1, _Reverse), _MM_SHUFFLE(1, 0, 3, 2)); // most significant last
+                const uint32_t _Val = static_cast<uint32_t>(_mm256_movemask_epi8(_Rev));
+                memcpy(_Dest_bytes + _Pos / 8, &_Val, sizeof(_Val));
+            }
+        }
+
+        if (_Size_convert - _Pos >= 16 && _Use_sse42()) { // for pshufb
+            const __m128i _Reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            const __m128i _Px0     = _Traits::_Set_sse(_Elem0);
+            const __m128i _Px1     = _Traits::_Set_sse(_Elem1);
+            for (; _Size_convert - _Pos >= 16; _Pos += 16) {
+                const _Elem* const _Block = _Src + (_Size_convert - _Pos - 16);
+                const __m128i _Eq1        = _Traits::_Cmp_sse(_Block, _Px1);
+                const __m128i _Eq0        = _Traits::_Cmp_sse(_Block, _Px0);
+                if (_mm_movemask_epi8(_mm_or_si128(_Eq0, _Eq1)) != 0xFFFF) {
+                    return false;
+                }
+
+                const uint16_t _Val = static_cast<uint16_t>(_mm_movemask_epi8(_mm_shuffle_epi8(_Eq1, _Reverse)));
+                memcpy(_Dest_bytes + _Pos / 8, &_Val, sizeof(_Val));
+            }
+        }
+#endif // !_M_ARM64EC
+
+        for (; _Pos != _Size_convert; ++_Pos) {
+            const _Elem _Ch = _Src[_Size_convert - 1 - _Pos];
+            if (_Ch == _Elem1) {
+                _Dest_bytes[_Pos / 8] |= static_cast<unsigned char>(1 << (_Pos % 8));
+            } else if (_Ch != _Elem0) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    size_t _Bitset_count_tail(const unsigned char* _Src, size_t _Size_bytes) noexcept {
+        // _Size_bytes is a multiple of 4, as the words of bitset are at least unsigned long
+        size_t _Result = 0;
+#ifndef _M_ARM64EC
+        if (_Use_sse42()) { // for popcnt
+            for (; _Size_bytes != 0; _Size_bytes -= 4, _Src += 4) {
+                unsigned int _Val;
+                memcpy(&_Val, _Src, sizeof(_Val));
+                _Result += __popcnt(_Val);
+            }
+
+            return _Result;
+        }
+#endif // !_M_ARM64EC
+
+        for (; _Size_bytes != 0; _Size_bytes -= 4, _Src += 4) {
+            uint32_t _Val;
+            memcpy(&_Val, _Src, sizeof(_Val));
+            _Val = _Val - ((_Val >> 1) & 0x5555'5555u);
+            _Val = (_Val & 0x3333'3333u) + ((_Val >> 2) & 0x3333'3333u);
+            _Val = (_Val + (_Val >> 4)) & 0x0F0F'0F0Fu;
+            _Result += (_Val * 0x0101'0101u) >> 24;
+        }
+
+        return _Result;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) void __stdcall __std_bitset_to_string_1(
+    char* const _Dest, const void* const _Src, const size_t _Size_bits, const char _Elem0, const char _Elem1) noexcept {
+    _Bitset_to_string(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+}
+
+__declspec(noalias) void __stdcall __std_bitset_to_string_2(wchar_t* const _Dest, const void* const _Src,
+    const size_t _Size_bits, const wchar_t _Elem0, const wchar_t _Elem1) noexcept {
+    _Bitset_to_string(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+}
+
+__declspec(noalias) bool __stdcall __std_bitset_from_string_1(void* const _Dest, const char* const _Src,
+    const size_t _Size_bytes, const size_t _Size_bits, const size_t _Size_chars, const char _Elem0,
+    const char _Elem1) noexcept {
+    return _Bitset_from_string<_Bitset_from_string_traits_1>(
+        _Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+}
+
+__declspec(noalias) bool __stdcall __std_bitset_from_string_2(void* const _Dest, const wchar_t* const _Src,
+    const size_t _Size_bytes, const size_t _Size_bits, const size_t _Size_chars, const wchar_t _Elem0,
+    const wchar_t _Elem1) noexcept {
+    return _Bitset_from_string<_Bitset_from_string_traits_2>(
+        _Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+}
+
+__declspec(noalias) size_t __stdcall __std_bitset_count(const void* const _Src, size_t _Size_bytes) noexcept {
+    auto _Src_bytes = static_cast<const unsigned char*>(_Src);
+    size_t _Result  = 0;
+#ifndef _M_ARM64EC
+    const size_t _Avx_size = _Size_bytes & ~size_t{0x1F};
+    if (_Avx_size != 0 && _Use_avx2()) {
+        _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+        // Counts the bits of each nibble with a lookup, then sums the bytes of each qword
+        const __m256i _Lookup = _mm256_set_epi8( //
+            4, 3, 3, 2, 3, 2, 2, 1, 3, 2, 2, 1, 2, 1, 1, 0, //
+            4, 3, 3, 2, 3, 2, 2, 1, 3, 2, 2, 1, 2, 1, 1, 0);
+        const __m256i _Low_nibble = _mm256_set1_epi8(0x0F);
+        __m256i _Sum              = _mm256_setzero_si256();
+
+        const unsigned char* const _Stop_at = _Src_bytes + _Avx_size;
+        do {
+            const __m256i _Data  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src_bytes));
+            const __m256i _Low   = _mm256_and_si256(_Data, _Low_nibble);
+            const __m256i _High  = _mm256_and_si256(_mm256_srli_epi16(_Data, 4), _Low_nibble);
+            const __m256i _Count =
+                _mm256_add_epi8(_mm256_shuffle_epi8(_Lookup, _Low), _mm256_shuffle_epi8(_Lookup, _High));
+            _Sum                 = _mm256_add_epi64(_Sum, _mm256_sad_epu8(_Count, _mm256_setzero_si256()));
+            _Src_bytes += 32;
+        } while (_Src_bytes != _Stop_at);
+
+        __m128i _Sum_128 = _mm_add_epi64(_mm256_castsi256_si128(_Sum), _mm256_extracti128_si256(_Sum, 1));
+        _Sum_128         = _mm_add_epi64(_Sum_128, _mm_unpackhi_epi64(_Sum_128, _Sum_128));
+#ifdef _M_IX86
+        _Result = static_cast<uint32_t>(_mm_cvtsi128_si32(_Sum_128));
+#else // ^^^ x86 / x64 vvv
+        _Result = static_cast<size_t>(_mm_cvtsi128_si64(_Sum_128));
+#endif // ^^^ x64 ^^^
+        _Size_bytes &= 0x1F;
+    }
+#endif // !_M_ARM64EC
+
+    return _Result + _Bitset_count_tail(_Src_bytes, _Size_bytes);
+}
+
+__declspec(noalias) bool __stdcall __std_bitset_any(const void* const _Src, size_t _Size_bytes) noexcept {
+    // _Size_bytes is a multiple of 4, as the words of bitset are at least unsigned long
+    auto _Src_bytes = static_cast<const unsigned char*>(_Src);
+#ifndef _M_ARM64EC
+    const size_t _Avx_size = _Size_bytes & ~size_t{0x3F};
+    if (_Avx_size != 0 && _Use_avx2()) {
+        _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+        // ORs two vectors at a time, and stops at the first pair with a bit set
+        const unsigned char* const _Stop_at = _Src_bytes + _Avx_size;
+        do {
+            const __m256i _Data1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src_bytes));
+            const __m256i _Data2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src_bytes + 32));
+            const __m256i _Data  = _mm256_or_si256(_Data1, _Data2);
+            if (!_mm256_testz_si256(_Data, _Data)) {
+                return true;
+            }
+
+            _Src_bytes += 64;
+        } while (_Src_bytes != _Stop_at);
+
+        _Size_bytes &= 0x3F;
+    }
+
+    const size_t _Sse_size = _Size_bytes & ~size_t{0xF};
+    if (_Sse_size != 0 && _Use_sse42()) { // for ptest
+        const unsigned char* const _Stop_at = _Src_bytes + _Sse_size;
+        do {
+            const __m128i _Data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src_bytes));
+            if (!_mm_testz_si128(_Data, _Data)) {
+                return true;
+            }
+
+            _Src_bytes += 16;
+        } while (_Src_bytes != _Stop_at);
+
+        _Size_bytes &= 0xF;
+    }
+#endif // !_M_ARM64EC
+
+    for (; _Size_bytes != 0; _Size_bytes -= 4, _Src_bytes += 4) {
+        uint32_t _Val;
+        memcpy(&_Val, _Src_bytes, sizeof(_Val));
+        if (_Val != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+__declspec(noalias) bool __stdcall __std_bitset_all(const void* const _Src, const size_t _Size_bits) noexcept {
+    // the bits past _Size_bits in the last word are zero, as bitset keeps them trimmed
+    auto _Src_bytes    = static_cast<const unsigned char*>(_Src);
+    size_t _Size_bytes = _Size_bits / 32 * 4; // whole 32-bit words, which must have every bit set
+#ifndef _M_ARM64EC
+    const size_t _Avx_size = _Size_bytes & ~size_t{0x3F};
+    if (_Avx_size != 0 && _Use_avx2()) {
+        _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+        // ANDs two vectors at a time, and stops at the first pair with a bit clear
+        const __m256i _Ones                 = _mm256_set1_epi8(-1);
+        const unsigned char* const _Stop_at = _Src_bytes + _Avx_size;
+        do {
+            const __m256i _Data1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src_bytes));
+            const __m256i _Data2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src_bytes + 32));
+            if (!_mm256_testc_si256(_mm256_and_si256(_Data1, _Data2), _Ones)) {
+                return false;
+            }
+
+            _Src_bytes += 64;
+        } while (_Src_bytes != _Stop_at);
+
+        _Size_bytes &= 0x3F;
+    }
+
+    const size_t _Sse_size = _Size_bytes & ~size_t{0xF};
+    if (_Sse_size != 0 && _Use_sse42()) { // for ptest
+        const __m128i _Ones                 = _mm_set1_epi8(-1);
+        const unsigned char* const _Stop_at = _Src_bytes + _Sse_size;
+        do {
+            const __m128i _Data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src_bytes));
+            if (!_mm_testc_si128(_Data, _Ones)) {
+                return false;
+            }
+
+            _Src_bytes += 16;
+        } while (_Src_bytes != _Stop_at);
+
+        _Size_bytes &= 0xF;
+    }
+#endif // !_M_ARM64EC
+
+    for (; _Size_bytes != 0; _Size_bytes -= 4, _Src_bytes += 4) {
+        uint32_t _Val;
+        memcpy(&_Val, _Src_bytes, sizeof(_Val));
+        if (_Val != 0xFFFF'FFFFu) {
+            return false;
+        }
+    }
+
+    const size_t _Tail_bits = _Size_bits % 32;
+    if (_Tail_bits != 0) {
+        uint32_t _Val;
+        memcpy(&_Val, _Src_bytes, sizeof(_Val));
+        return _Val == (uint32_t{1} << _Tail_bits) - 1;
+    }
+
+    return true;
+}
+
+} // extern "C"
+
+namespace {
+    struct _Vbool_and_traits {
+#ifndef _M_ARM64EC
+        static __m256i _Op_avx(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_and_si256(_Left, _Right);
+        }
+
+        static __m128i _Op_sse(const __m128i _Left, const __m128i _Right) noexcept {
+            return _mm_and_si128(_Left, _Right);
+        }
+#endif // !_M_ARM64EC
+
+        static uint32_t _Op(const uint32_t _Left, const uint32_t _Right) noexcept {
+            return _Left & _Right;
+        }
+    };
+
+    struct _Vbool_or_traits {
+#ifndef _M_ARM64EC
+        static __m256i _Op_avx(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_or_si256(_Left, _Right);
+        }
+
+        static __m128i _Op_sse(const __m128i _Left, const __m128i _Right) noexcept {
+            return _mm_or_si128(_Left, _Right);
+        }
+#endif // !_M_ARM64EC
+
+        static uint32_t _Op(const uint32_t _Left, const uint32_t _Right) noexcept {
+            return _Left | _Right;
+        }
+    };
+
+    struct _Vbool_xor_traits {
+#ifndef _M_ARM64EC
+        static __m256i _Op_avx(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_xor_si256(_Left, _Right);
+        }
+
+        static __m128i _Op_sse(const __m128i _Left, const __m128i _Right) noexcept {
+            return _mm_xor_si128(_Left, _Right);
+        }
+#endif // !_M_ARM64EC
+
+        static uint32_t _Op(const uint32_t _Left, const uint32_t _Right) noexcept {
+            return _Left ^ _Right;
+        }
+    };
+
+    struct _Vbool_not_traits { // ignores the right operand
+#ifndef _M_ARM64EC
+        static __m256i _Op_avx(const __m256i _Left, __m256i) noexcept {
+            return _mm256_xor_si256(_Left, _mm256_set1_epi32(-1));
+        }
+
+        static __m128i _Op_sse(const __m128i _Left, __m128i) noexcept {
+            return _mm_xor_si128(_Left, _mm_set1_epi32(-1));
+        }
+#endif // !_M_ARM64EC
+
+        static uint32_t _Op(const uint32_t _Left, uint32_t) noexcept {
+            return ~_Left;
+        }
+    };
+
+    template <class _Traits>
+    void _Vbool_bitwise(const void* _First1, const void* const _Last1, const void* _First2, void* _Dest) noexcept {
+        // _Dest may be equal to _First1 or _First2, as each vector is loaded before it is stored
+#ifndef _M_ARM64EC
+        const size_t _Size_bytes = _Byte_length(_First1, _Last1);
+
+        if (const size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            const void* _Stop_at = _First1;
+            _Advance_bytes(_Stop_at, _Avx_size);
+            do {
+                const __m256i _Left  = _mm256_loadu_si256(static_cast<const __m256i*>(_First1));
+                const __m256i _Right = _mm256_loadu_si256(static_cast<const __m256i*>(_First2));
+                _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Traits::_Op_avx(_Left, _Right));
+                _Advance_bytes(_First1, 32);
+                _Advance_bytes(_First2, 32);
+                _Advance_bytes(_Dest, 32);
+            } while (_First1 != _Stop_at);
+        } else if (const size_t _Sse_size = _Size_bytes & ~size_t{0xF}; _Sse_size != 0 && _Use_sse2()) {
+            const void* _Stop_at = _First1;
+            _Advance_bytes(_Stop_at, _Sse_size);
+            do {
+                const __m128i _Left  = _mm_loadu_si128(static_cast<const __m128i*>(_First1));
+                const __m128i _Right = _mm_loadu_si128(static_cast<const __m128i*>(_First2));
+                _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Traits::_Op_sse(_Left, _Right));
+                _Advance_bytes(_First1, 16);
+                _Advance_bytes(_First2, 16);
+                _Advance_bytes(_Dest, 16);
+            } while (_First1 != _Stop_at);
+        }
+#endif // !_M_ARM64EC
+
+        auto _Ptr1     = static_cast<const uint32_t*>(_First1);
+        auto _Ptr2     = static_cast<const uint32_t*>(_First2);
+        auto _Ptr_dest = static_cast<uint32_t*>(_Dest);
+        for (; _Ptr1 != _Last1; ++_Ptr1, ++_Ptr2, ++_Ptr_dest) {
+            *_Ptr_dest = _Traits::_Op(*_Ptr1, *_Ptr2);
+        }
+    }
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) const void* __stdcall __std_vbool_find_word(
+    const void* _First, const void* const _Last, const bool _Val) noexcept {
+    // find the first word holding a bit equal to _Val, that is, the first word that is not all !_Val
+    const uint32_t _Skip = _Val ? 0 : UINT32_MAX;
+#ifndef _M_ARM64EC
+    const size_t _Size_bytes = _Byte_length(_First, _Last);
+
+    if (const size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
+        _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+        const __m256i _Comparand = _mm256_set1_epi32(static_cast<int>(_Skip));
+        const void* _Stop_at     = _First;
+        _Advance_bytes(_Stop_at, _Avx_size);
+        do {
+            const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+            const unsigned int _Bingo =
+                ~static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(_Data, _Comparand)));
+            if (_Bingo != 0) {
+                _Advance_bytes(_First, _tzcnt_u32(_Bingo));
+                return _First;
+            }
+
+            _Advance_bytes(_First, 32);
+        } while (_First != _Stop_at);
+    } else if (const size_t _Sse_size = _Size_bytes & ~size_t{0xF}; _Sse_size != 0 && _Use_sse2()) {
+        const __m128i _Comparand = _mm_set1_epi32(static_cast<int>(_Skip));
+        const void* _Stop_at     = _First;
+        _Advance_bytes(_Stop_at, _Sse_size);
+        do {
+            const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+            const unsigned int _Bingo =
+                static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi32(_Data, _Comparand))) ^ 0xFFFF;
+            if (_Bingo != 0) {
+                unsigned long _Offset;
+                _BitScanForward(&_Offset, _Bingo); // lgtm [cpp/conditionallyuninitializedvariable]
+                _Advance_bytes(_First, _Offset);
+                return _First;
+            }
+
+            _Advance_bytes(_First, 16);
+        } while (_First != _Stop_at);
+    }
+#endif // !_M_ARM64EC
+
+    auto _Ptr = static_cast<const uint32_t*>(_First);
+    for (; _Ptr != _Last; ++_Ptr) {
+        if (*_Ptr != _Skip) {
+            break;
+        }
+    }
+
+    return _Ptr;
+}
+
+__declspec(noalias) size_t __stdcall __std_vbool_count(const void* const _First, const void* const _Last) noexcept {
+    return __std_bitset_count(_First, _Byte_length(_First, _Last));
+}
+
+__declspec(noalias) void __stdcall __std_vbool_and(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    _Vbool_bitwise<_Vbool_and_traits>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_vbool_or(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    _Vbool_bitwise<_Vbool_or_traits>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_vbool_xor(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    _Vbool_bitwise<_Vbool_xor_traits>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_vbool_not(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    _Vbool_bitwise<_Vbool_not_traits>(_First, _Last, _First, _Dest);
+}
+
 } // extern "C"
 #endif // defined(_M_IX86) || defined(_M_X64)
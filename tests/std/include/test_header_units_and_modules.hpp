@@ -236,6 +236,24 @@ void test_filesystem() {
     assert(info.capacity != static_cast<decltype(info.capacity)>(-1));
 }
 
+#if TEST_STANDARD >= 23
+void test_flat_map() {
+    using namespace std;
+    puts("Testing <flat_map>.");
+    flat_map<int, int> fm{{30, 33}, {10, 11}, {20, 22}};
+    assert(fm.begin()->first == 10);
+    assert(fm[20] == 22);
+}
+
+void test_flat_set() {
+    using namespace std;
+    puts("Testing <flat_set>.");
+    const flat_set<int> fs{30, 10, 20, 10};
+    assert(fs.size() == 3);
+    assert(*fs.begin() == 10);
+}
+#endif // TEST_STANDARD >= 23
+
 void test_format() {
     using namespace std;
     puts("Testing <format>.");
@@ -1140,6 +1158,10 @@ void all_cpp_header_tests() {
     test_expected();
 #endif // TEST_STANDARD >= 23
     test_filesystem();
+#if TEST_STANDARD >= 23
+    test_flat_map();
+    test_flat_set();
+#endif // TEST_STANDARD >= 23
     test_format();
     test_forward_list();
     test_fstream();
@@ -1304,6 +1304,122 @@ void randomized_test_copy(mt19937_64& gen) {
     }
 }
 
+template <class BinaryOp>
+void test_transform_binary(const vector<bool>& vb1, const vector<bool>& vb2, const int first1, const int first2,
+    const int dest, const int len, BinaryOp op) {
+    const vector<uint8_t> v8_1(vb1.cbegin(), vb1.cend());
+    const vector<uint8_t> v8_2(vb2.cbegin(), vb2.cend());
+
+    vector<bool> vb_dst(vb1.size() + dest);
+    vector<uint8_t> v8_dst(vb_dst.cbegin(), vb_dst.cend());
+
+    const auto result = transform(
+        vb1.cbegin() + first1, vb1.cbegin() + first1 + len, vb2.cbegin() + first2, vb_dst.begin() + dest, op);
+    transform(v8_1.cbegin() + first1, v8_1.cbegin() + first1 + len, v8_2.cbegin() + first2, v8_dst.begin() + dest,
+        [op](const bool left, const bool right) { return static_cast<bool>(op(left, right)); });
+
+    assert(result == vb_dst.begin() + dest + len);
+    assert(equal(vb_dst.cbegin(), vb_dst.cend(), v8_dst.cbegin(), v8_dst.cend(), equal_to<uint8_t>{}));
+
+    // in place, as in a.assign(a & b)
+    vector<bool> vb_in_place = vb1;
+    vector<uint8_t> v8_in_place(vb_in_place.cbegin(), vb_in_place.cend());
+    transform(vb_in_place.cbegin() + first1, vb_in_place.cbegin() + first1 + len, vb2.cbegin() + first2,
+        vb_in_place.begin() + first1, op);
+    transform(v8_in_place.cbegin() + first1, v8_in_place.cbegin() + first1 + len, v8_2.cbegin() + first2,
+        v8_in_place.begin() + first1,
+        [op](const bool left, const bool right) { return static_cast<bool>(op(left, right)); });
+    assert(equal(vb_in_place.cbegin(), vb_in_place.cend(), v8_in_place.cbegin(), v8_in_place.cend(),
+        equal_to<uint8_t>{}));
+}
+
+void randomized_test_word_algorithms(mt19937_64& gen) {
+    uniform_int_distribution<int> affix_dist{0, 2 * blockSize - 1};
+    uniform_int_distribution<int> len_dist{0, 12 * blockSize}; // long enough for the vectorized middle words
+    auto bool_dist = [&gen] { return static_cast<bool>(gen() & 1); };
+
+    constexpr int repetitions = 1'000;
+
+    for (int k = 0; k < repetitions; ++k) {
+        const int prefix1 = affix_dist(gen);
+        const int prefix2 = k % 2 == 0 ? prefix1 : affix_dist(gen); // half of the ranges have matching offsets
+        const int len     = len_dist(gen);
+        const int suffix  = affix_dist(gen);
+
+        // vb1: <prefix1> <len> <suffix>
+        // vb2: <prefix2> <len> <suffix>, equal to vb1 over <len> except for at most one flipped bit
+
+        vector<bool> vb1(prefix1 + len + suffix);
+        generate(vb1.begin(), vb1.end(), bool_dist);
+        if (k % 3 == 0) { // long runs of equal bits exercise the skipping of whole words
+            fill(vb1.begin() + prefix1, vb1.begin() + prefix1 + len, k % 2 == 0);
+        }
+
+        vector<bool> vb2(prefix2 + len + suffix);
+        generate(vb2.begin(), vb2.end(), bool_dist);
+        copy(vb1.cbegin() + prefix1, vb1.cbegin() + prefix1 + len, vb2.begin() + prefix2);
+
+        int flipped = len;
+        if (len != 0 && k % 4 != 0) {
+            flipped = uniform_int_distribution<int>{0, len - 1}(gen);
+            vb2[static_cast<size_t>(prefix2 + flipped)].flip();
+        }
+
+        const auto first1 = vb1.cbegin() + prefix1;
+        const auto last1  = first1 + len;
+        const auto first2 = vb2.cbegin() + prefix2;
+
+        // mismatch and equal
+        const auto mismatched = mismatch(first1, last1, first2);
+        assert(mismatched.first - first1 == flipped);
+        assert(mismatched.second - first2 == flipped);
+        assert(mismatch(first1, last1, first2, first2 + len, equal_to<bool>{}).first - first1 == flipped);
+        assert(equal(first1, last1, first2) == (flipped == len));
+        assert(equal(first1, last1, first2, first2 + len, equal_to<bool>{}) == (flipped == len));
+
+        // find_if and find_if_not with logical_not
+        assert(find_if(first1, last1, logical_not<>{}) == find(first1, last1, false));
+        assert(find_if(first1, last1, logical_not<bool>{}) == find(first1, last1, false));
+        assert(find_if_not(first1, last1, logical_not<>{}) == find(first1, last1, true));
+        const vector<uint8_t> v8_1(vb1.cbegin(), vb1.cend());
+        assert(find_if(first1, last1, logical_not<>{}) - first1
+               == find(v8_1.cbegin() + prefix1, v8_1.cbegin() + prefix1 + len, uint8_t{0}) - (v8_1.cbegin() + prefix1));
+
+        // transform
+        const int dest = k % 2 == 0 ? prefix1 : affix_dist(gen);
+        test_transform_binary(vb1, vb2, prefix1, prefix2, dest, len, bit_and<>{});
+        test_transform_binary(vb1, vb2, prefix1, prefix2, dest, len, bit_or<bool>{});
+        test_transform_binary(vb1, vb2, prefix1, prefix2, dest, len, bit_xor<>{});
+        test_transform_binary(vb1, vb2, prefix1, prefix2, dest, len, logical_and<bool>{});
+        test_transform_binary(vb1, vb2, prefix1, prefix2, dest, len, logical_or<>{});
+        test_transform_binary(vb1, vb2, prefix1, prefix2, dest, len, not_equal_to<>{});
+
+        vector<bool> vb_not(vb1.size() + dest);
+        vector<uint8_t> v8_not(vb_not.cbegin(), vb_not.cend());
+        const auto not_result = transform(first1, last1, vb_not.begin() + dest, logical_not<>{});
+        transform(v8_1.cbegin() + prefix1, v8_1.cbegin() + prefix1 + len, v8_not.begin() + dest,
+            [](const bool val) { return !val; });
+        assert(not_result == vb_not.begin() + dest + len);
+        assert(equal(vb_not.cbegin(), vb_not.cend(), v8_not.cbegin(), v8_not.cend(), equal_to<uint8_t>{}));
+
+#if _HAS_CXX23 && defined(__cpp_lib_concepts) // vector<bool>::iterator is an output_iterator since C++23
+        // ranges::fill and ranges::fill_n
+        for (const bool val : {false, true}) {
+            vector<bool> vb_fill = vb1;
+            vector<uint8_t> v8_fill(vb_fill.cbegin(), vb_fill.cend());
+            assert(ranges::fill(vb_fill.begin() + prefix1, vb_fill.begin() + prefix1 + len, val)
+                   == vb_fill.begin() + prefix1 + len);
+            fill(v8_fill.begin() + prefix1, v8_fill.begin() + prefix1 + len, static_cast<uint8_t>(val));
+            assert(equal(vb_fill.cbegin(), vb_fill.cend(), v8_fill.cbegin(), v8_fill.cend(), equal_to<uint8_t>{}));
+
+            assert(ranges::fill_n(vb_fill.begin() + prefix1, len, !val) == vb_fill.begin() + prefix1 + len);
+            fill(v8_fill.begin() + prefix1, v8_fill.begin() + prefix1 + len, static_cast<uint8_t>(!val));
+            assert(equal(vb_fill.cbegin(), vb_fill.cend(), v8_fill.cbegin(), v8_fill.cend(), equal_to<uint8_t>{}));
+        }
+#endif // _HAS_CXX23 && defined(__cpp_lib_concepts)
+    }
+}
+
 int main() {
     test_fill();
     test_find();
@@ -1315,4 +1431,5 @@ int main() {
     mt19937_64 gen;
     initialize_randomness(gen);
     randomized_test_copy(gen);
+    randomized_test_word_algorithms(gen);
 }
@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto is_even = [](unsigned int i) { return (i & 0x1u) == 0; };
+
+template <template <class...> class Container>
+void test_case_copy_if_family_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> source(testSize);
+    vector<unsigned int> expected(testSize);
+    vector<unsigned int> actual(testSize);
+    vector<unsigned int> expectedFalse(testSize);
+    vector<unsigned int> actualFalse(testSize);
+
+    const auto test_all = [&] {
+        auto expectedLast = copy_if(source.begin(), source.end(), expected.begin(), is_even);
+        auto actualLast   = copy_if(par, source.begin(), source.end(), actual.begin(), is_even);
+        assert(equal(expected.begin(), expectedLast, actual.begin(), actualLast));
+
+        expectedLast = remove_copy_if(source.begin(), source.end(), expected.begin(), is_even);
+        actualLast   = remove_copy_if(par, source.begin(), source.end(), actual.begin(), is_even);
+        assert(equal(expected.begin(), expectedLast, actual.begin(), actualLast));
+
+        const unsigned int removed = testSize == 0 ? 0U : *source.begin();
+        expectedLast               = remove_copy(source.begin(), source.end(), expected.begin(), removed);
+        actualLast                 = remove_copy(par, source.begin(), source.end(), actual.begin(), removed);
+        assert(equal(expected.begin(), expectedLast, actual.begin(), actualLast));
+
+        const auto expectedPair =
+            partition_copy(source.begin(), source.end(), expected.begin(), expectedFalse.begin(), is_even);
+        const auto actualPair =
+            partition_copy(par, source.begin(), source.end(), actual.begin(), actualFalse.begin(), is_even);
+        assert(equal(expected.begin(), expectedPair.first, actual.begin(), actualPair.first));
+        assert(equal(expectedFalse.begin(), expectedPair.second, actualFalse.begin(), actualPair.second));
+    };
+
+    // copy everything, then nothing:
+    fill(source.begin(), source.end(), 2U);
+    test_all();
+    fill(source.begin(), source.end(), 1U);
+    test_all();
+
+    // "fuzz" testing:
+    for (int i = 0; i < 100; ++i) {
+        generate(source.begin(), source.end(), ref(gen));
+        test_all();
+    }
+}
+
+void test_case_non_random_access_dest(const size_t testSize, mt19937& gen) {
+    // chunks can't place their results independently, so these run serially
+    vector<unsigned int> source(testSize);
+    generate(source.begin(), source.end(), ref(gen));
+
+    list<unsigned int> expected(testSize);
+    list<unsigned int> actual(testSize);
+    auto expectedLast = copy_if(source.begin(), source.end(), expected.begin(), is_even);
+    auto actualLast   = copy_if(par, source.begin(), source.end(), actual.begin(), is_even);
+    assert(equal(expected.begin(), expectedLast, actual.begin(), actualLast));
+
+    list<unsigned int> expectedFalse(testSize);
+    list<unsigned int> actualFalse(testSize);
+    const auto expectedPair =
+        partition_copy(source.begin(), source.end(), expected.begin(), expectedFalse.begin(), is_even);
+    const auto actualPair =
+        partition_copy(par, source.begin(), source.end(), actual.begin(), actualFalse.begin(), is_even);
+    assert(equal(expected.begin(), expectedPair.first, actual.begin(), actualPair.first));
+    assert(equal(expectedFalse.begin(), expectedPair.second, actualFalse.begin(), actualPair.second));
+}
+
+void test_case_predicate_applied_once() {
+    vector<unsigned int> source(10'000);
+    vector<unsigned int> dest(source.size());
+    for (unsigned int i = 0; i < source.size(); ++i) {
+        source[i] = i;
+    }
+
+    vector<unsigned char> applied(source.size());
+    const auto last = copy_if(par, source.begin(), source.end(), dest.begin(), [&](const unsigned int& i) {
+        ++applied[static_cast<size_t>(&i - source.data())];
+        return is_even(i);
+    });
+
+    assert(last - dest.begin() == 5'000);
+    assert(all_of(applied.begin(), applied.end(), [](unsigned char count) { return count == 1; }));
+    for (unsigned int i = 0; i < 5'000; ++i) {
+        assert(dest[i] == i * 2);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_copy_if_family_parallel<forward_list>, gen);
+    parallel_test_case(test_case_copy_if_family_parallel<list>, gen);
+    parallel_test_case(test_case_copy_if_family_parallel<vector>, gen);
+    parallel_test_case(test_case_non_random_access_dest, gen);
+
+    test_case_predicate_applied_once();
+}
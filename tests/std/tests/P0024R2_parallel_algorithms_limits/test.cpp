@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+static_assert(is_execution_policy_v<decltype(par.with(2))>);
+static_assert(is_execution_policy_v<decltype(par_unseq.with(2, 1000))>);
+static_assert(is_execution_policy_v<const decltype(par.with(0, 0))>);
+
+struct concurrency_tracker {
+    atomic<size_t> active{0};
+    atomic<size_t> peak{0};
+
+    void enter() {
+        const size_t now = ++active;
+        size_t old       = peak.load();
+        while (old < now && !peak.compare_exchange_weak(old, now)) {
+        }
+
+        this_thread::yield(); // give other threads a chance to overlap with this one
+    }
+
+    void leave() {
+        --active;
+    }
+};
+
+template <class ExecutionPolicy>
+void test_max_threads(const ExecutionPolicy& exec, const size_t maxThreads) {
+    // at most maxThreads threads, including the calling thread, run element access functions concurrently
+    concurrency_tracker tracker;
+    vector<int> v(max_parallel_test_case_n * 8);
+    for_each(exec, v.begin(), v.end(), [&](int& x) {
+        tracker.enter();
+        x = 1;
+        tracker.leave();
+    });
+
+    assert(count(v.begin(), v.end(), 1) == static_cast<ptrdiff_t>(v.size()));
+    assert(tracker.peak.load() <= maxThreads);
+}
+
+void test_serial_when_max_threads_is_1() {
+    const auto caller = this_thread::get_id();
+    vector<int> v(max_parallel_test_case_n);
+    for_each(par.with(1), v.begin(), v.end(), [&](int&) { assert(this_thread::get_id() == caller); });
+    sort(par.with(1), v.begin(), v.end(), [&](int a, int b) {
+        assert(this_thread::get_id() == caller);
+        return a < b;
+    });
+}
+
+void test_single_chunk_when_min_chunk_covers_range() {
+    // with a minimum chunk at least as large as the input, all elements are processed by the same thread
+    vector<thread::id> ids(max_parallel_test_case_n);
+    for_each(par.with(0, ids.size()), ids.begin(), ids.end(), [](thread::id& id) { id = this_thread::get_id(); });
+    assert(all_of(ids.begin(), ids.end(), [&](const thread::id& id) { return id == ids.front(); }));
+}
+
+void test_nested_standard_policy_is_unlimited() {
+    // the limits of par.with() apply to that call only, not to par calls nested in its element access functions
+    const auto caller = this_thread::get_id();
+    vector<int> outer(4);
+    for_each(par.with(1, 16), outer.begin(), outer.end(), [&](int& x) {
+        assert(this_thread::get_id() == caller);
+        assert(__std_parallel_algorithms_get_limits()._Max_threads == 1);
+
+        vector<int> inner(max_parallel_test_case_n * 8);
+        for_each(par, inner.begin(), inner.end(), [&](int& y) {
+            if (this_thread::get_id() == caller) {
+                const auto limits = __std_parallel_algorithms_get_limits();
+                assert(limits._Max_threads == 0);
+                assert(limits._Min_chunk == 0);
+            }
+
+            y = 1;
+        });
+
+        // the enclosing call's limits are back in effect
+        const auto limits = __std_parallel_algorithms_get_limits();
+        assert(limits._Max_threads == 1);
+        assert(limits._Min_chunk == 16);
+        x = static_cast<int>(count(par_unseq, inner.begin(), inner.end(), 1));
+    });
+
+    const int innerSize = static_cast<int>(max_parallel_test_case_n * 8);
+    assert(all_of(outer.begin(), outer.end(), [&](int x) { return x == innerSize; }));
+    assert(__std_parallel_algorithms_get_limits()._Max_threads == 0);
+}
+
+template <class ExecutionPolicy>
+void test_results(const ExecutionPolicy& exec) {
+    // limits only change how work is scheduled, not the results
+    const size_t testSize = max_parallel_test_case_n * 4;
+    vector<unsigned int> v(testSize);
+    for (size_t i = 0; i < testSize; ++i) {
+        v[i] = static_cast<unsigned int>((i * 2654435761u) % 1000u);
+    }
+
+    auto expected = v;
+    sort(expected.begin(), expected.end());
+
+    auto sorted = v;
+    sort(exec, sorted.begin(), sorted.end());
+    assert(sorted == expected);
+
+    auto stableSorted = v;
+    stable_sort(exec, stableSorted.begin(), stableSorted.end());
+    assert(stableSorted == expected);
+
+    assert(reduce(exec, v.begin(), v.end(), size_t{0}) == accumulate(v.begin(), v.end(), size_t{0}));
+
+    vector<size_t> scanned(testSize);
+    inclusive_scan(exec, v.begin(), v.end(), scanned.begin(), plus<size_t>{}, size_t{0});
+    size_t sum = 0;
+    for (size_t i = 0; i < testSize; ++i) {
+        sum += v[i];
+        assert(scanned[i] == sum);
+    }
+
+    assert(find(exec, v.begin(), v.end(), 1000u) == v.end());
+    assert(count(exec, v.begin(), v.end(), v[testSize / 2]) == count(v.begin(), v.end(), v[testSize / 2]));
+}
+
+int main() {
+    test_max_threads(par.with(1), 1);
+    test_max_threads(par.with(2), 2);
+    test_max_threads(par_unseq.with(3, 16), 3);
+    test_serial_when_max_threads_is_1();
+    test_single_chunk_when_min_chunk_covers_range();
+    test_nested_standard_policy_is_unlimited();
+
+    test_results(par.with(1));
+    test_results(par.with(2));
+    test_results(par.with(0, 100));
+    test_results(par.with(3, 5000));
+    test_results(par_unseq.with(0, 0));
+    test_results(par_unseq.with(2, max_parallel_test_case_n * 100));
+}
@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <list>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// Elements compare only by key; the tag records where an element came from, to check stability.
+using tagged = pair<unsigned int, size_t>;
+
+const auto key_less    = [](const tagged& lhs, const tagged& rhs) { return lhs.first < rhs.first; };
+const auto key_greater = [](const tagged& lhs, const tagged& rhs) { return lhs.first > rhs.first; };
+
+template <class Pr>
+vector<tagged> make_sorted(const size_t size, const unsigned int maxKey, const size_t firstTag, mt19937& gen, Pr pred) {
+    uniform_int_distribution<unsigned int> dis(0, maxKey);
+    vector<tagged> result(size);
+    for (auto& elem : result) {
+        elem.first = dis(gen);
+    }
+
+    sort(result.begin(), result.end(), pred);
+    for (size_t i = 0; i < size; ++i) {
+        result[i].second = firstTag + i;
+    }
+
+    return result;
+}
+
+template <class Pr>
+void test_merge_sizes(const size_t size1, const size_t size2, const unsigned int maxKey, mt19937& gen, Pr pred) {
+    const auto first  = make_sorted(size1, maxKey, 0, gen, pred);
+    const auto second = make_sorted(size2, maxKey, size1, gen, pred);
+    vector<tagged> expected(size1 + size2);
+    vector<tagged> actual(size1 + size2);
+
+    const auto expectedLast = merge(first.begin(), first.end(), second.begin(), second.end(), expected.begin(), pred);
+    const auto actualLast = merge(par, first.begin(), first.end(), second.begin(), second.end(), actual.begin(), pred);
+    assert(expectedLast == expected.end());
+    assert(actualLast == actual.end());
+    assert(expected == actual);
+
+    vector<tagged> inplace(first);
+    inplace.insert(inplace.end(), second.begin(), second.end());
+    inplace_merge(par, inplace.begin(), inplace.begin() + static_cast<ptrdiff_t>(size1), inplace.end(), pred);
+    assert(expected == inplace);
+}
+
+void test_case_merge_parallel(const size_t testSize, mt19937& gen) {
+    for (const unsigned int maxKey : {0U, 3U, static_cast<unsigned int>(testSize)}) {
+        test_merge_sizes(testSize, testSize, maxKey, gen, key_less);
+        test_merge_sizes(testSize, testSize / 3, maxKey, gen, key_less);
+        test_merge_sizes(testSize / 3, testSize, maxKey, gen, key_less);
+        test_merge_sizes(testSize, 0, maxKey, gen, key_less);
+        test_merge_sizes(0, testSize, maxKey, gen, key_less);
+        test_merge_sizes(testSize, testSize / 2, maxKey, gen, key_greater);
+    }
+
+    // disjoint ranges, already in order and in reverse order
+    vector<unsigned int> low(testSize);
+    vector<unsigned int> high(testSize);
+    for (unsigned int i = 0; i < testSize; ++i) {
+        low[i]  = i;
+        high[i] = static_cast<unsigned int>(testSize) + i;
+    }
+
+    vector<unsigned int> expected(low);
+    expected.insert(expected.end(), high.begin(), high.end());
+    vector<unsigned int> actual(testSize * 2);
+    assert(merge(par, low.begin(), low.end(), high.begin(), high.end(), actual.begin()) == actual.end());
+    assert(expected == actual);
+    assert(merge(par, high.begin(), high.end(), low.begin(), low.end(), actual.begin()) == actual.end());
+    assert(expected == actual);
+
+    actual = high;
+    actual.insert(actual.end(), low.begin(), low.end());
+    inplace_merge(par, actual.begin(), actual.begin() + static_cast<ptrdiff_t>(testSize), actual.end());
+    assert(expected == actual);
+}
+
+void test_case_merge_non_random_access(const size_t testSize, mt19937& gen) {
+    // the ranges can't be co-ranked in constant time, so these run serially
+    const auto first  = make_sorted(testSize, 3U, 0, gen, key_less);
+    const auto second = make_sorted(testSize / 2, 3U, testSize, gen, key_less);
+    vector<tagged> expected(first.size() + second.size());
+    merge(first.begin(), first.end(), second.begin(), second.end(), expected.begin(), key_less);
+
+    list<tagged> actual(first.begin(), first.end());
+    actual.insert(actual.end(), second.begin(), second.end());
+    inplace_merge(par, actual.begin(), next(actual.begin(), static_cast<ptrdiff_t>(testSize)), actual.end(), key_less);
+    assert(equal(expected.begin(), expected.end(), actual.begin(), actual.end()));
+
+    const list<tagged> firstList(first.begin(), first.end());
+    const list<tagged> secondList(second.begin(), second.end());
+    list<tagged> dest(expected.size());
+    merge(par, firstList.begin(), firstList.end(), secondList.begin(), secondList.end(), dest.begin(), key_less);
+    assert(equal(expected.begin(), expected.end(), dest.begin(), dest.end()));
+}
+
+void test_case_inplace_merge_move_only(const size_t testSize) {
+    vector<unique_ptr<size_t>> source;
+    for (size_t i = 0; i < testSize; ++i) {
+        source.push_back(make_unique<size_t>(i * 2 + 1));
+    }
+
+    for (size_t i = 0; i < testSize; ++i) {
+        source.push_back(make_unique<size_t>(i * 2));
+    }
+
+    inplace_merge(par, source.begin(), source.begin() + static_cast<ptrdiff_t>(testSize), source.end(),
+        [](const unique_ptr<size_t>& lhs, const unique_ptr<size_t>& rhs) { return *lhs < *rhs; });
+    for (size_t i = 0; i < source.size(); ++i) {
+        assert(*source[i] == i);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_merge_parallel, gen);
+    parallel_test_case(test_case_merge_non_random_access, gen);
+    parallel_test_case(test_case_inplace_merge_move_only);
+}
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+template <class Pr>
+void check_nth_element(const vector<int>& input, const size_t nth, Pr pred) {
+    auto expected = input;
+    sort(expected.begin(), expected.end(), pred);
+    auto actual      = input;
+    const auto nthIt = actual.begin() + static_cast<ptrdiff_t>(nth);
+    nth_element(par, actual.begin(), nthIt, actual.end(), pred);
+    if (nth == input.size()) {
+        assert(actual == input); // nth == last has no effect
+        return;
+    }
+
+    const int nthVal = *nthIt;
+    assert(nthVal == expected[nth]);
+    assert(none_of(actual.begin(), nthIt, [&](int val) { return pred(nthVal, val); }));
+    assert(none_of(nthIt, actual.end(), [&](int val) { return pred(val, nthVal); }));
+    sort(actual.begin(), actual.end(), pred);
+    assert(actual == expected);
+}
+
+void test_case_nth_element_parallel(const size_t testSize, mt19937& gen) {
+    vector<int> c(testSize);
+    iota(c.begin(), c.end(), 0);
+    shuffle(c.begin(), c.end(), gen);
+    for (const size_t nth : {size_t{0}, testSize / 2, testSize}) {
+        check_nth_element(c, nth, less<>{});
+    }
+
+    if (testSize != 0) {
+        check_nth_element(c, testSize - 1, greater<>{});
+    }
+}
+
+void test_case_nth_element_parallel_large(mt19937& gen) {
+    // large enough to be partitioned around sampled pivots before the remainder is finished serially
+    const size_t testSize = max_parallel_test_case_n * 64;
+    vector<int> distinct(testSize);
+    iota(distinct.begin(), distinct.end(), 0);
+    const auto ascending = distinct;
+    shuffle(distinct.begin(), distinct.end(), gen);
+
+    vector<int> fewValues(testSize); // many elements equivalent to any pivot
+    uniform_int_distribution<int> dist(0, 3);
+    generate(fewValues.begin(), fewValues.end(), [&] { return dist(gen); });
+
+    for (const auto& input : {distinct, ascending, fewValues}) {
+        for (const size_t nth : {size_t{0}, size_t{1}, testSize / 3, testSize / 2, testSize - 1, testSize}) {
+            check_nth_element(input, nth, less<>{});
+            check_nth_element(input, nth, greater<>{});
+        }
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+
+    parallel_test_case(test_case_nth_element_parallel, gen);
+    test_case_nth_element_parallel_large(gen);
+}
@@ -58,9 +58,43 @@ void test_case_partition_parallel(const size_t testSize, mt19937& gen) {
     }
 }
 
+template <template <class...> class Container>
+void test_case_stable_partition_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> tmp(testSize);
+    Container<unsigned int> expected(testSize);
+
+    // "fuzz" testing; the serial stable_partition is the oracle, since the order of each partition is specified:
+    for (int i = 0; i < 100; ++i) {
+        generate(tmp.begin(), tmp.end(), ref(gen));
+        expected                  = tmp;
+        const auto expectedResult = stable_partition(expected.begin(), expected.end(), is_even);
+        const auto actualResult   = stable_partition(par, tmp.begin(), tmp.end(), is_even);
+        assert(tmp == expected);
+        assert(distance(tmp.begin(), actualResult) == distance(expected.begin(), expectedResult));
+    }
+}
+
+void test_case_stable_partition_strings(const size_t testSize) {
+    // strings exercise moving non-trivially-copyable elements through the temporary buffer
+    vector<string> tmp(testSize);
+    for (size_t i = 0; i < testSize; ++i) {
+        tmp[i] = string(20 + i % 7, static_cast<char>('a' + i % 26));
+    }
+
+    auto expected            = tmp;
+    const auto isShort       = [](const string& str) { return str.size() < 23; };
+    const auto expectedCount = stable_partition(expected.begin(), expected.end(), isShort) - expected.begin();
+    const auto actualCount   = stable_partition(par, tmp.begin(), tmp.end(), isShort) - tmp.begin();
+    assert(tmp == expected);
+    assert(actualCount == expectedCount);
+}
+
 int main() {
     mt19937 gen(1729);
     parallel_test_case(test_case_partition_parallel<forward_list>, gen);
     parallel_test_case(test_case_partition_parallel<list>, gen);
     parallel_test_case(test_case_partition_parallel<vector>, gen);
+    parallel_test_case(test_case_stable_partition_parallel<list>, gen);
+    parallel_test_case(test_case_stable_partition_parallel<vector>, gen);
+    parallel_test_case(test_case_stable_partition_strings);
 }
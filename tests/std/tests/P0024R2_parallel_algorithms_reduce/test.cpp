@@ -79,5 +79,9 @@ int main() {
     parallel_test_case(test_case_reduce, gen);
     parallel_test_case([](const size_t testSize) { test_case_move_only(seq, testSize); });
     parallel_test_case([](const size_t testSize) { test_case_move_only(par, testSize); });
+    parallel_test_case([](const size_t testSize) { test_case_move_only(par_unseq, testSize); });
+#if _HAS_CXX20
+    parallel_test_case([](const size_t testSize) { test_case_move_only(unseq, testSize); });
+#endif // _HAS_CXX20
     test_case_incorrect_special_case_reasoning();
 }
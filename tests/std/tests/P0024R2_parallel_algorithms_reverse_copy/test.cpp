@@ -0,0 +1,102 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+template <class T>
+vector<T> make_input(const size_t testSize) {
+    vector<T> result;
+    result.reserve(testSize);
+    for (size_t i = 0; i < testSize; ++i) {
+        if constexpr (is_same_v<T, string>) {
+            result.push_back(to_string(i));
+        } else {
+            result.push_back(static_cast<T>(i));
+        }
+    }
+
+    return result;
+}
+
+template <class T>
+void check_reverse_copy(const size_t testSize) {
+    const auto input = make_input<T>(testSize);
+    const vector<T> expected(input.rbegin(), input.rend());
+    vector<T> output(testSize);
+    assert(reverse_copy(par, input.begin(), input.end(), output.begin()) == output.end());
+    assert(output == expected);
+
+    const list<T> inputList(input.begin(), input.end());
+    forward_list<T> outputList(testSize);
+    assert(reverse_copy(par, inputList.begin(), inputList.end(), outputList.begin()) == outputList.end());
+    assert(equal(outputList.begin(), outputList.end(), expected.begin(), expected.end()));
+}
+
+void test_case_reverse_copy_parallel(const size_t testSize) {
+    // element sizes 1, 2, 4 and 8 are reversed by the vectorized kernels, 12 and string are not
+    struct three_ints {
+        int a;
+        int b;
+        int c;
+
+        explicit three_ints(const size_t i = 0) : a(static_cast<int>(i)), b(a + 1), c(a + 2) {}
+
+        bool operator==(const three_ints& other) const {
+            return a == other.a && b == other.b && c == other.c;
+        }
+    };
+
+    check_reverse_copy<unsigned char>(testSize);
+    check_reverse_copy<short>(testSize);
+    check_reverse_copy<int>(testSize);
+    check_reverse_copy<long long>(testSize);
+    check_reverse_copy<three_ints>(testSize);
+    check_reverse_copy<string>(testSize);
+}
+
+template <class T>
+void check_rotate_copy(const size_t testSize) {
+    const auto input = make_input<T>(testSize);
+    const forward_list<T> inputList(input.begin(), input.end());
+    vector<T> output(testSize);
+    for (const size_t mid : {size_t{0}, size_t{1}, testSize / 3, testSize - 1, testSize}) {
+        if (mid > testSize) {
+            continue;
+        }
+
+        auto expected = input;
+        rotate(expected.begin(), expected.begin() + static_cast<ptrdiff_t>(mid), expected.end());
+        assert(rotate_copy(par, input.begin(), input.begin() + static_cast<ptrdiff_t>(mid), input.end(), output.begin())
+               == output.end());
+        assert(output == expected);
+
+        output.assign(testSize, T{});
+        const auto listMid = next(inputList.begin(), static_cast<ptrdiff_t>(mid));
+        assert(rotate_copy(par, inputList.begin(), listMid, inputList.end(), output.begin()) == output.end());
+        assert(output == expected);
+    }
+}
+
+void test_case_rotate_copy_parallel(const size_t testSize) {
+    check_rotate_copy<int>(testSize);
+    check_rotate_copy<string>(testSize);
+}
+
+int main() {
+    parallel_test_case(test_case_reverse_copy_parallel);
+    parallel_test_case(test_case_rotate_copy_parallel);
+}
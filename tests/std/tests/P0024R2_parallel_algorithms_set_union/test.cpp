@@ -0,0 +1,136 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// Elements compare only by key; the tag records where an element came from, to check which copies are chosen.
+using tagged = pair<unsigned int, size_t>;
+
+const auto key_less    = [](const tagged& lhs, const tagged& rhs) { return lhs.first < rhs.first; };
+const auto key_greater = [](const tagged& lhs, const tagged& rhs) { return lhs.first > rhs.first; };
+
+template <class Pr>
+vector<tagged> make_sorted(const size_t size, const unsigned int maxKey, const size_t firstTag, mt19937& gen, Pr pred) {
+    uniform_int_distribution<unsigned int> dis(0, maxKey);
+    vector<tagged> result(size);
+    for (auto& elem : result) {
+        elem.first = dis(gen);
+    }
+
+    sort(result.begin(), result.end(), pred);
+    for (size_t i = 0; i < size; ++i) {
+        result[i].second = firstTag + i;
+    }
+
+    return result;
+}
+
+template <class Pr>
+void test_set_ops_sizes(const size_t size1, const size_t size2, const unsigned int maxKey, mt19937& gen, Pr pred) {
+    const auto first  = make_sorted(size1, maxKey, 0, gen, pred);
+    const auto second = make_sorted(size2, maxKey, size1, gen, pred);
+    vector<tagged> expected(size1 + size2);
+    vector<tagged> actual(size1 + size2);
+
+    auto expectedLast = set_union(first.begin(), first.end(), second.begin(), second.end(), expected.begin(), pred);
+    auto actualLast   = set_union(par, first.begin(), first.end(), second.begin(), second.end(), actual.begin(), pred);
+    assert(equal(expected.begin(), expectedLast, actual.begin(), actualLast));
+
+    expectedLast = set_symmetric_difference(
+        first.begin(), first.end(), second.begin(), second.end(), expected.begin(), pred);
+    actualLast = set_symmetric_difference(
+        par, first.begin(), first.end(), second.begin(), second.end(), actual.begin(), pred);
+    assert(equal(expected.begin(), expectedLast, actual.begin(), actualLast));
+
+    assert(includes(par, first.begin(), first.end(), second.begin(), second.end(), pred)
+           == includes(first.begin(), first.end(), second.begin(), second.end(), pred));
+    assert(includes(par, second.begin(), second.end(), first.begin(), first.end(), pred)
+           == includes(second.begin(), second.end(), first.begin(), first.end(), pred));
+}
+
+void test_case_set_union_parallel(const size_t testSize, mt19937& gen) {
+    for (const unsigned int maxKey : {0U, 3U, static_cast<unsigned int>(testSize)}) {
+        test_set_ops_sizes(testSize, testSize, maxKey, gen, key_less);
+        test_set_ops_sizes(testSize, testSize / 3, maxKey, gen, key_less);
+        test_set_ops_sizes(testSize / 3, testSize, maxKey, gen, key_less);
+        test_set_ops_sizes(testSize, 0, maxKey, gen, key_less);
+        test_set_ops_sizes(0, testSize, maxKey, gen, key_less);
+        test_set_ops_sizes(testSize, testSize / 2, maxKey, gen, key_greater);
+    }
+
+    // evens and odds, and a subset of a set
+    vector<unsigned int> all(testSize);
+    vector<unsigned int> evens;
+    vector<unsigned int> odds;
+    for (unsigned int i = 0; i < testSize; ++i) {
+        all[i] = i;
+        if (i % 2 == 0) {
+            evens.push_back(i);
+        } else {
+            odds.push_back(i);
+        }
+    }
+
+    vector<unsigned int> actual(testSize);
+    auto actualLast = set_union(par, evens.begin(), evens.end(), odds.begin(), odds.end(), actual.begin());
+    assert(equal(all.begin(), all.end(), actual.begin(), actualLast));
+    actualLast = set_symmetric_difference(par, evens.begin(), evens.end(), odds.begin(), odds.end(), actual.begin());
+    assert(equal(all.begin(), all.end(), actual.begin(), actualLast));
+    actualLast = set_union(par, all.begin(), all.end(), odds.begin(), odds.end(), actual.begin());
+    assert(equal(all.begin(), all.end(), actual.begin(), actualLast));
+    actualLast = set_symmetric_difference(par, all.begin(), all.end(), odds.begin(), odds.end(), actual.begin());
+    assert(equal(evens.begin(), evens.end(), actual.begin(), actualLast));
+
+    assert(includes(par, all.begin(), all.end(), evens.begin(), evens.end()));
+    assert(includes(par, all.begin(), all.end(), odds.begin(), odds.end()));
+    assert(includes(par, all.begin(), all.end(), all.begin(), all.end()));
+    assert(includes(par, evens.begin(), evens.end(), odds.begin(), odds.end()) == odds.empty());
+    assert(includes(par, odds.begin(), odds.end(), all.begin(), all.end()) == all.empty());
+    if (testSize != 0) {
+        // a single missing element at the end
+        assert(!includes(par, all.begin(), all.end() - 1, all.begin(), all.end()));
+    }
+}
+
+void test_case_set_union_non_random_access(const size_t testSize, mt19937& gen) {
+    // the ranges can't be split in constant time, so these run serially
+    const auto firstVec  = make_sorted(testSize, 3U, 0, gen, key_less);
+    const auto secondVec = make_sorted(testSize / 2, 3U, testSize, gen, key_less);
+    const list<tagged> first(firstVec.begin(), firstVec.end());
+    const list<tagged> second(secondVec.begin(), secondVec.end());
+    vector<tagged> expected(first.size() + second.size());
+    list<tagged> actual(first.size() + second.size());
+
+    auto expectedLast = set_union(first.begin(), first.end(), second.begin(), second.end(), expected.begin(), key_less);
+    auto actualLast =
+        set_union(par, first.begin(), first.end(), second.begin(), second.end(), actual.begin(), key_less);
+    assert(equal(expected.begin(), expectedLast, actual.begin(), actualLast));
+
+    expectedLast = set_symmetric_difference(
+        first.begin(), first.end(), second.begin(), second.end(), expected.begin(), key_less);
+    actualLast = set_symmetric_difference(
+        par, first.begin(), first.end(), second.begin(), second.end(), actual.begin(), key_less);
+    assert(equal(expected.begin(), expectedLast, actual.begin(), actualLast));
+
+    assert(includes(par, first.begin(), first.end(), second.begin(), second.end(), key_less)
+           == includes(first.begin(), first.end(), second.begin(), second.end(), key_less));
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_set_union_parallel, gen);
+    parallel_test_case(test_case_set_union_non_random_access, gen);
+}
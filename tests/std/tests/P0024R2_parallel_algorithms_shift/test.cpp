@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <initializer_list>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+void check_shift(const size_t testSize, const ptrdiff_t shift) {
+    const auto size = static_cast<ptrdiff_t>(testSize);
+    const auto kept = max(size - shift, ptrdiff_t{0});
+    vector<int> expected(testSize);
+    iota(expected.begin(), expected.end(), 0);
+
+    {
+        auto actual           = expected;
+        const auto resultLast = shift_left(par, actual.begin(), actual.end(), shift);
+        assert(resultLast == actual.begin() + kept);
+        assert(equal(actual.begin(), resultLast, expected.end() - kept));
+    }
+
+    {
+        auto actual            = expected;
+        const auto resultFirst = shift_right(par, actual.begin(), actual.end(), shift);
+        assert(resultFirst == actual.end() - kept);
+        assert(equal(resultFirst, actual.end(), expected.begin()));
+    }
+
+    {
+        // moved-from strings are left in the vacated positions; only the shifted elements are checked
+        vector<string> strings;
+        for (const int val : expected) {
+            strings.push_back(to_string(val) + " is long enough to avoid the small string optimization");
+        }
+
+        auto actual           = strings;
+        const auto resultLast = shift_left(par, actual.begin(), actual.end(), shift);
+        assert(equal(actual.begin(), resultLast, strings.end() - kept, strings.end()));
+
+        actual                 = strings;
+        const auto resultFirst = shift_right(par, actual.begin(), actual.end(), shift);
+        assert(equal(resultFirst, actual.end(), strings.begin(), strings.begin() + kept));
+    }
+
+    {
+        // not random-access, so not parallelized
+        list<int> actual(expected.begin(), expected.end());
+        const auto resultLast = shift_left(par, actual.begin(), actual.end(), shift);
+        assert(equal(actual.begin(), resultLast, expected.end() - kept, expected.end()));
+    }
+}
+
+void test_case_shift_parallel(const size_t testSize) {
+    const auto size = static_cast<ptrdiff_t>(testSize);
+    for (const ptrdiff_t shift : {ptrdiff_t{0}, ptrdiff_t{1}, size / 3, size / 2, size - 1, size, size + 1}) {
+        if (shift >= 0) {
+            check_shift(testSize, shift);
+        }
+    }
+}
+
+void test_case_shift_parallel_large() {
+    // large enough for overlapping source and destination ranges to be moved in parallel rounds, when there are no
+    // more rounds than threads (as with a shift of 10'000 or more); smaller shifts are done serially
+    const size_t testSize = 30'000;
+    for (const ptrdiff_t shift : {4095, 4096, 7777, 10'000, 14'999, 15'000}) {
+        check_shift(testSize, shift);
+    }
+}
+
+int main() {
+    parallel_test_case(test_case_shift_parallel);
+    test_case_shift_parallel_large();
+}
@@ -3,7 +3,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <climits>
+#include <cstddef>
 #include <execution>
+#include <functional>
 #include <numeric>
 #include <random>
 #include <vector>
@@ -35,9 +38,103 @@ void test_case_sort_parallel(const size_t testSize, mt19937& gen) {
     assert(is_sorted(c.begin(), c.end()));
 }
 
+template <class T, class Pr>
+void check_sort_parallel(vector<T> c, Pr pred) {
+    auto expected = c;
+    sort(expected.begin(), expected.end(), pred);
+    sort(par, c.begin(), c.end(), pred);
+    assert(c == expected);
+}
+
+void test_case_sort_parallel_large(mt19937& gen) {
+    // large enough for arithmetic elements to be radix sorted, and for the first partitions to be run in parallel
+    const size_t testSize = max_parallel_test_case_n * 128;
+    vector<int> ints(testSize);
+    uniform_int_distribution<int> intDist(-1000000, 1000000);
+    generate(ints.begin(), ints.end(), [&] { return intDist(gen); });
+    check_sort_parallel(ints, less<>{});
+    check_sort_parallel(ints, less<int>{});
+    check_sort_parallel(ints, greater<>{});
+    check_sort_parallel(ints, [](int x, int y) { return x < y; });
+
+    vector<int> fewUnique(testSize); // many elements equivalent to each pivot
+    uniform_int_distribution<int> fewDist(0, 3);
+    generate(fewUnique.begin(), fewUnique.end(), [&] { return fewDist(gen); });
+    check_sort_parallel(fewUnique, less<>{});
+    check_sort_parallel(fewUnique, [](int x, int y) { return x < y; });
+
+    vector<int> ascending(testSize);
+    iota(ascending.begin(), ascending.end(), -static_cast<int>(testSize / 2));
+    check_sort_parallel(ascending, less<>{});
+    check_sort_parallel(ascending, greater<>{});
+
+    vector<double> doubles(testSize);
+    uniform_real_distribution<double> doubleDist(-1e9, 1e9);
+    generate(doubles.begin(), doubles.end(), [&] { return doubleDist(gen); });
+    doubles[0] = 0.0;
+    doubles[1] = -0.0;
+    check_sort_parallel(doubles, less<>{});
+
+    vector<unsigned char> bytes(testSize);
+    uniform_int_distribution<int> byteDist(0, 255);
+    generate(bytes.begin(), bytes.end(), [&] { return static_cast<unsigned char>(byteDist(gen)); });
+    check_sort_parallel(bytes, less<>{});
+
+    vector<long long> wide(testSize);
+    uniform_int_distribution<long long> wideDist(LLONG_MIN, LLONG_MAX);
+    generate(wide.begin(), wide.end(), [&] { return wideDist(gen); });
+    check_sort_parallel(wide, less<long long>{});
+}
+
+template <class Pr>
+void check_partial_sort(const vector<size_t>& input, const size_t k, Pr pred) {
+    // partial_sort the first min(k, input.size()) elements, and partial_sort_copy into a destination of size k
+    auto expected = input;
+    sort(expected.begin(), expected.end(), pred);
+    const auto sortedCount = static_cast<ptrdiff_t>(min(k, input.size()));
+
+    auto actual    = input;
+    const auto kIt = actual.begin() + sortedCount;
+    partial_sort(par, actual.begin(), kIt, actual.end(), pred);
+    assert(equal(actual.begin(), kIt, expected.begin()));
+    sort(kIt, actual.end(), pred);
+    assert(actual == expected);
+
+    vector<size_t> out(k);
+    const auto copyEnd = partial_sort_copy(par, input.begin(), input.end(), out.begin(), out.end(), pred);
+    assert(copyEnd == out.begin() + sortedCount);
+    assert(equal(out.begin(), out.begin() + sortedCount, expected.begin()));
+}
+
+void test_case_partial_sort_parallel(const size_t testSize, mt19937& gen) {
+    vector<size_t> c(testSize);
+    iota(c.begin(), c.end(), static_cast<size_t>(0));
+    shuffle(c.begin(), c.end(), gen);
+    for (const size_t k : {size_t{0}, size_t{1}, testSize / 2, testSize}) {
+        check_partial_sort(c, k, less<>{});
+    }
+
+    check_partial_sort(c, testSize + 3, greater<>{}); // partial_sort_copy into a larger destination
+}
+
+void test_case_partial_sort_parallel_large(mt19937& gen) {
+    // large enough for small k to select candidates from each chunk, and for larger k to quicksort in parallel
+    const size_t testSize = max_parallel_test_case_n * 64;
+    vector<size_t> c(testSize);
+    uniform_int_distribution<size_t> dist(static_cast<size_t>(0), testSize / 4); // add duplicate elements
+    generate(c.begin(), c.end(), [&] { return dist(gen); });
+    for (const size_t k : {size_t{1}, size_t{10}, size_t{50}, max_parallel_test_case_n, testSize / 2, testSize}) {
+        check_partial_sort(c, k, less<>{});
+        check_partial_sort(c, k, greater<>{});
+    }
+}
+
 int main() {
     mt19937 gen(1729);
 
     test_case_sort_parallel_special_cases();
     parallel_test_case(test_case_sort_parallel, gen);
+    test_case_sort_parallel_large(gen);
+    parallel_test_case(test_case_partial_sort_parallel, gen);
+    test_case_partial_sort_parallel_large(gen);
 }
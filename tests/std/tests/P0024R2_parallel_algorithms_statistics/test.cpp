@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+#if !_STL_PARALLEL_ALGORITHMS_STATISTICS
+#error This test requires _STL_PARALLEL_ALGORITHMS_STATISTICS=1.
+#endif // !_STL_PARALLEL_ALGORITHMS_STATISTICS
+
+const bool parallelizes = thread::hardware_concurrency() > 1;
+
+void test_calls_are_counted() {
+    reset_parallel_statistics();
+    const auto empty = get_parallel_statistics();
+    assert(empty.calls == 0);
+    assert(empty.chunks == 0);
+    assert(empty.steals == 0);
+    assert(empty.serial_fallbacks == 0);
+    assert(empty.wait_ns == 0);
+
+    vector<int> v(max_parallel_test_case_n * 8);
+    for_each(seq, v.begin(), v.end(), [](int& x) { x = 1; });
+    assert(get_parallel_statistics().calls == 0); // sequenced calls aren't recorded
+
+    for_each(par, v.begin(), v.end(), [](int& x) { ++x; });
+    const auto afterForEach = get_parallel_statistics();
+    assert(afterForEach.calls == 1);
+    assert(afterForEach.serial_fallbacks == 0);
+    if (parallelizes) {
+        assert(afterForEach.chunks > 1);
+    }
+
+    // a single thread doesn't partition anything
+    for_each(par.with(1), v.begin(), v.end(), [](int& x) { ++x; });
+    const auto afterLimited = get_parallel_statistics();
+    assert(afterLimited.calls == 2);
+    assert(afterLimited.chunks == afterForEach.chunks);
+
+    assert(count(par_unseq, v.begin(), v.end(), 3) == static_cast<ptrdiff_t>(v.size()));
+    assert(get_parallel_statistics().calls == 3);
+
+    reset_parallel_statistics();
+    assert(get_parallel_statistics().calls == 0);
+}
+
+void test_work_on_other_threads_is_recorded() {
+    // chunks of the scan and stolen sort work items are recorded by whichever thread handles them, into the
+    // statistics of the thread that started the call
+    reset_parallel_statistics();
+    vector<int> v(max_parallel_test_case_n * 64);
+    iota(v.begin(), v.end(), 0);
+    inclusive_scan(par, v.begin(), v.end(), v.begin());
+    shuffle(v.begin(), v.end(), mt19937{1729});
+    sort(par, v.begin(), v.end(), greater<>{});
+    assert(is_sorted(v.begin(), v.end(), greater<>{}));
+
+    const auto stats = get_parallel_statistics();
+    assert(stats.calls == 2);
+    assert(stats.serial_fallbacks == 0);
+    if (parallelizes) {
+        assert(stats.chunks > 1);
+    } else {
+        assert(stats.steals == 0);
+    }
+}
+
+void test_statistics_are_per_thread() {
+    reset_parallel_statistics();
+    vector<int> v(max_parallel_test_case_n * 8);
+    size_t otherCalls = 0;
+    thread other{[&] {
+        for_each(par, v.begin(), v.end(), [](int& x) { x = 42; });
+        otherCalls = get_parallel_statistics().calls;
+    }};
+    other.join();
+
+    assert(otherCalls == 1);
+    assert(get_parallel_statistics().calls == 0);
+}
+
+int main() {
+    test_calls_are_counted();
+    test_work_on_other_threads_is_recorded();
+    test_statistics_are_per_thread();
+}
@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Exercises the std::thread work-stealing backend, which STL_PARALLEL_ALGORITHMS_BACKEND=threads selects when it is
+// set before the first parallel algorithm runs.
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <execution>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+constexpr unsigned int worker_count = 3;
+
+void test_backend_is_selected() {
+    // the std::thread backend reports its worker count as the hardware concurrency
+    assert(__std_parallel_algorithms_hw_threads() == worker_count);
+
+    // element access functions run on the calling thread and at most worker_count workers
+    mutex idsLock;
+    set<thread::id> ids;
+    vector<int> v(max_parallel_test_case_n * 8);
+    for_each(par, v.begin(), v.end(), [&](int& x) {
+        x = 1;
+        lock_guard<mutex> guard(idsLock);
+        ids.insert(this_thread::get_id());
+    });
+
+    assert(count(v.begin(), v.end(), 1) == static_cast<ptrdiff_t>(v.size()));
+    ids.erase(this_thread::get_id());
+    assert(ids.size() <= worker_count);
+}
+
+void test_nested() {
+    // more nested calls than workers: workers waiting for a nested call must help run it instead of blocking the pool
+    const size_t outerSize = worker_count * 4;
+    const size_t innerSize = max_parallel_test_case_n * 4;
+    vector<vector<unsigned int>> inner(outerSize);
+    for_each(par, inner.begin(), inner.end(), [&](vector<unsigned int>& data) {
+        data.resize(innerSize);
+        iota(data.begin(), data.end(), 0u);
+        reverse(par, data.begin(), data.end());
+        sort(par, data.begin(), data.end());
+        assert(is_sorted(par, data.begin(), data.end()));
+        for_each(par_unseq, data.begin(), data.end(), [](unsigned int& x) { x *= 2; });
+    });
+
+    const unsigned long long expected = static_cast<unsigned long long>(innerSize) * (innerSize - 1);
+    for (const auto& data : inner) {
+        assert(transform_reduce(par, data.begin(), data.end(), 0ull, plus<>{},
+                   [](unsigned int x) { return static_cast<unsigned long long>(x); })
+               == expected);
+    }
+}
+
+void test_cancellation() {
+    // algorithms that stop early leave no work behind that could touch their (destroyed) state
+    for (size_t pos : {size_t{0}, size_t{1}, max_parallel_test_case_n, max_parallel_test_case_n * 8 - 1}) {
+        vector<int> v(max_parallel_test_case_n * 8);
+        v[pos] = 1;
+        assert(find(par, v.begin(), v.end(), 1) == v.begin() + static_cast<ptrdiff_t>(pos));
+        assert(any_of(par, v.begin(), v.end(), [](int x) { return x == 1; }));
+        assert(!all_of(par, v.begin(), v.end(), [](int x) { return x == 0; }));
+
+        vector<int> w(v.size());
+        assert(mismatch(par, v.begin(), v.end(), w.begin()).first == v.begin() + static_cast<ptrdiff_t>(pos));
+    }
+
+    // cancellation of nested calls doesn't cancel the outer call
+    vector<int> outer(worker_count * 4);
+    for_each(par, outer.begin(), outer.end(), [](int& x) {
+        vector<int> v(max_parallel_test_case_n * 4);
+        v[v.size() / 2] = 1;
+        x               = static_cast<int>(find(par, v.begin(), v.end(), 1) - v.begin());
+    });
+
+    const int half = static_cast<int>(max_parallel_test_case_n * 2);
+    assert(all_of(outer.begin(), outer.end(), [&](int x) { return x == half; }));
+}
+
+void test_exceptions() {
+    // exceptions that are caught inside element access functions running on the workers don't disturb the pool
+    atomic<size_t> caught{0};
+    vector<int> v(max_parallel_test_case_n * 8);
+    iota(v.begin(), v.end(), 0);
+    for_each(par, v.begin(), v.end(), [&](int& x) {
+        try {
+            if (x % 7 == 0) {
+                throw runtime_error("multiple of 7");
+            }
+
+            vector<int> nested(16, x);
+            x = reduce(par, nested.begin(), nested.end());
+        } catch (const runtime_error&) {
+            ++caught;
+            x = -1;
+        }
+    });
+
+    assert(caught.load() == (v.size() + 6) / 7);
+    for (size_t i = 0; i < v.size(); ++i) {
+        assert(v[i] == (i % 7 == 0 ? -1 : static_cast<int>(i * 16)));
+    }
+
+    // the pool still runs later calls
+    sort(par, v.begin(), v.end());
+    assert(is_sorted(v.begin(), v.end()));
+}
+
+int main() {
+    // before any parallel algorithm runs, as the backend is selected once per process
+    assert(_wputenv_s(L"STL_PARALLEL_ALGORITHMS_BACKEND", L"threads") == 0);
+    assert(_wputenv_s(L"STL_PARALLEL_ALGORITHMS_THREADS", L"3") == 0);
+
+    test_backend_is_selected();
+    test_nested();
+    test_cancellation();
+    test_exceptions();
+}
@@ -173,6 +173,12 @@ int main() {
     parallel_test_case([](const size_t testSize) { test_case_move_only_binary(par, testSize); });
     parallel_test_case([](const size_t testSize) { test_case_move_only(seq, testSize); });
     parallel_test_case([](const size_t testSize) { test_case_move_only(par, testSize); });
+    parallel_test_case([](const size_t testSize) { test_case_move_only_binary(par_unseq, testSize); });
+    parallel_test_case([](const size_t testSize) { test_case_move_only(par_unseq, testSize); });
+#if _HAS_CXX20
+    parallel_test_case([](const size_t testSize) { test_case_move_only_binary(unseq, testSize); });
+    parallel_test_case([](const size_t testSize) { test_case_move_only(unseq, testSize); });
+#endif // _HAS_CXX20
     test_case_incorrect_special_case_reasoning();
     test_case_narrowing_conversion();
 }
@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+struct movable_uint {
+    unsigned int value;
+    /* implicit */ operator unsigned int() const {
+        return value;
+    }
+
+    movable_uint() : value{} {}
+    /* implicit */ movable_uint(unsigned int x) : value(x) {}
+    movable_uint(const movable_uint&)            = delete;
+    movable_uint(movable_uint&&)                 = default;
+    movable_uint& operator=(const movable_uint&) = delete;
+    movable_uint& operator=(movable_uint&&)      = default;
+};
+
+const auto same_parity = [](unsigned int lhs, unsigned int rhs) { return ((lhs ^ rhs) & 0x1u) == 0; };
+
+template <template <class...> class Container>
+void test_case_unique_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> tmp(testSize);
+    Container<unsigned int> tested(testSize);
+    vector<unsigned int> serialCopy(testSize);
+    vector<unsigned int> parallelCopy(testSize);
+
+    {
+        // all elements equal, only the first one remains:
+        fill(tested.begin(), tested.end(), 42U);
+        const auto result = unique(par, tested.begin(), tested.end());
+        if (testSize == 0) {
+            assert(result == tested.end());
+        } else {
+            assert(result == next(tested.begin()));
+            assert(*tested.begin() == 42U);
+        }
+
+        const auto copyResult = unique_copy(par, tmp.begin(), tmp.end(), parallelCopy.begin());
+        assert(copyResult == parallelCopy.begin() + (testSize == 0 ? 0 : 1));
+    }
+
+    // "fuzz" testing, with values drawn from a small domain so that runs of matching elements span chunk boundaries:
+    for (int i = 0; i < 100; ++i) {
+        const unsigned int domain = (i & 0x1) == 0 ? 2U : 5U;
+        generate(tmp.begin(), tmp.end(), [&] { return static_cast<unsigned int>(gen() % domain); });
+
+        const auto serialCopyResult   = unique_copy(tmp.begin(), tmp.end(), serialCopy.begin());
+        const auto parallelCopyResult = unique_copy(par, tmp.begin(), tmp.end(), parallelCopy.begin());
+        assert(equal(serialCopy.begin(), serialCopyResult, parallelCopy.begin(), parallelCopyResult));
+
+        const auto serialPredCopyResult   = unique_copy(tmp.begin(), tmp.end(), serialCopy.begin(), same_parity);
+        const auto parallelPredCopyResult = unique_copy(par, tmp.begin(), tmp.end(), parallelCopy.begin(), same_parity);
+        assert(equal(serialCopy.begin(), serialPredCopyResult, parallelCopy.begin(), parallelPredCopyResult));
+
+        Container<unsigned int> serialTested(tmp);
+        tested                    = tmp;
+        const auto serialResult   = unique(serialTested.begin(), serialTested.end());
+        const auto parallelResult = unique(par, tested.begin(), tested.end());
+        assert(equal(serialTested.begin(), serialResult, tested.begin(), parallelResult));
+
+        serialTested                  = tmp;
+        tested                        = tmp;
+        const auto serialPredResult   = unique(serialTested.begin(), serialTested.end(), same_parity);
+        const auto parallelPredResult = unique(par, tested.begin(), tested.end(), same_parity);
+        assert(equal(serialTested.begin(), serialPredResult, tested.begin(), parallelPredResult));
+    }
+}
+
+void test_case_move_only_elements() {
+    vector<movable_uint> tmp(10);
+    for (size_t i = 0; i < tmp.size(); ++i) {
+        tmp[i] = static_cast<unsigned int>(i / 3);
+    }
+
+    const auto result = unique(par, tmp.begin(), tmp.end(), equal_to<unsigned int>{});
+    assert(result - tmp.begin() == 4);
+    for (unsigned int i = 0; i < 4; ++i) {
+        assert(tmp[i] == i);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_unique_parallel<forward_list>, gen);
+    parallel_test_case(test_case_unique_parallel<list>, gen);
+    parallel_test_case(test_case_unique_parallel<vector>, gen);
+
+    test_case_move_only_elements();
+}
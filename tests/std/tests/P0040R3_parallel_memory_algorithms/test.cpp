@@ -6,6 +6,7 @@
 #include <execution>
 #include <memory>
 #include <numeric>
+#include <string>
 #include <vector>
 
 #include <parallel_algorithms_utilities.hpp>
@@ -398,6 +399,71 @@ struct test_case_uninitialized_fill_n_parallel {
     }
 };
 
+string make_nontrivial_string(const size_t i) {
+    // long enough to defeat the small string optimization
+    return string(32, static_cast<char>('a' + i % 26)) + to_string(i);
+}
+
+struct test_case_uninitialized_copy_nontrivial_parallel {
+    template <class ExecutionPolicy>
+    void operator()(const size_t testSize, const ExecutionPolicy& exec) {
+        vector<string> source(testSize);
+        for (size_t i = 0; i != testSize; ++i) {
+            source[i] = make_nontrivial_string(i);
+        }
+
+        auto buffer         = make_unconstructed_nondestroying_buffer<string>(testSize);
+        const auto begin_it = buffer.get();
+        const auto end_it   = begin_it + testSize;
+
+        const auto result_it = uninitialized_copy(exec, source.begin(), source.end(), begin_it);
+        assert(end_it == result_it);
+        assert(equal(source.begin(), source.end(), begin_it, end_it));
+        destroy(exec, begin_it, end_it);
+    }
+};
+
+struct test_case_uninitialized_move_n_nontrivial_parallel {
+    template <class ExecutionPolicy>
+    void operator()(const size_t testSize, const ExecutionPolicy& exec) {
+        vector<string> source(testSize);
+        for (size_t i = 0; i != testSize; ++i) {
+            source[i] = make_nontrivial_string(i);
+        }
+
+        auto buffer         = make_unconstructed_nondestroying_buffer<string>(testSize);
+        const auto begin_it = buffer.get();
+        const auto end_it   = begin_it + testSize;
+
+        const auto result_pair = uninitialized_move_n(exec, source.begin(), testSize, begin_it);
+        assert(source.end() == result_pair.first && end_it == result_pair.second);
+        for (size_t i = 0; i != testSize; ++i) {
+            assert(begin_it[i] == make_nontrivial_string(i));
+        }
+
+        destroy_n(exec, begin_it, testSize);
+    }
+};
+
+struct test_case_uninitialized_fill_nontrivial_parallel {
+    template <class ExecutionPolicy>
+    void operator()(const size_t testSize, const ExecutionPolicy& exec) {
+        const auto value    = make_nontrivial_string(1729);
+        auto buffer         = make_unconstructed_nondestroying_buffer<string>(testSize);
+        const auto begin_it = buffer.get();
+        const auto end_it   = begin_it + testSize;
+
+        uninitialized_fill(exec, begin_it, end_it, value);
+        assert(all_of(begin_it, end_it, [&](const string& str) { return str == value; }));
+        destroy(exec, begin_it, end_it);
+
+        const auto result_it = uninitialized_fill_n(exec, begin_it, testSize, value);
+        assert(end_it == result_it);
+        assert(all_of(begin_it, end_it, [&](const string& str) { return str == value; }));
+        destroy(exec, begin_it, end_it);
+    }
+};
+
 int main() {
     parallel_test_case(test_case_uninitialized_default_construct_parallel{}, par);
     parallel_test_case(test_case_uninitialized_default_construct_n_parallel{}, par);
@@ -413,14 +479,15 @@ int main() {
     parallel_test_case(test_case_destroy_n_parallel{}, par);
     parallel_test_case(test_case_destroy_nontrivial_parallel{}, par);
     parallel_test_case(test_case_destroy_n_nontrivial_parallel{}, par);
-
-    // currently not parallelized
     parallel_test_case(test_case_uninitialized_copy_parallel{}, par);
     parallel_test_case(test_case_uninitialized_copy_n_parallel{}, par);
     parallel_test_case(test_case_uninitialized_move_parallel{}, par);
     parallel_test_case(test_case_uninitialized_move_n_parallel{}, par);
     parallel_test_case(test_case_uninitialized_fill_parallel{}, par);
     parallel_test_case(test_case_uninitialized_fill_n_parallel{}, par);
+    parallel_test_case(test_case_uninitialized_copy_nontrivial_parallel{}, par);
+    parallel_test_case(test_case_uninitialized_move_n_nontrivial_parallel{}, par);
+    parallel_test_case(test_case_uninitialized_fill_nontrivial_parallel{}, par);
 #if _HAS_CXX20
     parallel_test_case(test_case_uninitialized_default_construct_parallel{}, unseq);
     parallel_test_case(test_case_uninitialized_default_construct_n_parallel{}, unseq);
@@ -436,13 +503,14 @@ int main() {
     parallel_test_case(test_case_destroy_n_parallel{}, unseq);
     parallel_test_case(test_case_destroy_nontrivial_parallel{}, unseq);
     parallel_test_case(test_case_destroy_n_nontrivial_parallel{}, unseq);
-
-    // currently not parallelized
     parallel_test_case(test_case_uninitialized_copy_parallel{}, unseq);
     parallel_test_case(test_case_uninitialized_copy_n_parallel{}, unseq);
     parallel_test_case(test_case_uninitialized_move_parallel{}, unseq);
     parallel_test_case(test_case_uninitialized_move_n_parallel{}, unseq);
     parallel_test_case(test_case_uninitialized_fill_parallel{}, unseq);
     parallel_test_case(test_case_uninitialized_fill_n_parallel{}, unseq);
+    parallel_test_case(test_case_uninitialized_copy_nontrivial_parallel{}, unseq);
+    parallel_test_case(test_case_uninitialized_move_n_nontrivial_parallel{}, unseq);
+    parallel_test_case(test_case_uninitialized_fill_nontrivial_parallel{}, unseq);
 #endif // _HAS_CXX20
 }
@@ -0,0 +1,293 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <deque>
+#include <flat_map>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class FlatMap, class Ref>
+void assert_same_contents(const FlatMap& fm, const Ref& ref) {
+    assert(fm.size() == ref.size());
+    assert(fm.keys().size() == fm.values().size());
+    assert(equal(fm.begin(), fm.end(), ref.begin(), ref.end(),
+        [](const auto& left, const auto& right) { return left.first == right.first && left.second == right.second; }));
+}
+
+template <class FlatMap, class Ref>
+void test_bulk_insert_against(const int rounds) {
+    FlatMap fm;
+    Ref ref;
+    mt19937 gen{1729};
+    uniform_int_distribution<int> key_dist{0, 500};
+    for (int round = 0; round < rounds; ++round) {
+        vector<pair<int, int>> batch;
+        for (int i = 0; i < 200; ++i) {
+            batch.emplace_back(key_dist(gen), round * 1000 + i);
+        }
+
+        fm.insert(batch.begin(), batch.end());
+        ref.insert(batch.begin(), batch.end());
+        assert_same_contents(fm, ref);
+
+        sort(batch.begin(), batch.end(), [](const auto& left, const auto& right) { return left.first < right.first; });
+        if constexpr (is_same_v<Ref, map<int, int>>) {
+            batch.erase(unique(batch.begin(), batch.end(),
+                            [](const auto& left, const auto& right) { return left.first == right.first; }),
+                batch.end());
+            fm.insert(sorted_unique, batch.begin(), batch.end());
+        } else {
+            fm.insert(sorted_equivalent, batch.begin(), batch.end());
+        }
+
+        ref.insert(batch.begin(), batch.end());
+        assert_same_contents(fm, ref);
+    }
+}
+
+void test_construction() {
+    const vector<int> keys{5, 1, 3, 1, 4};
+    const vector<string> values{"five", "one", "three", "uno", "four"};
+
+    flat_map<int, string> fm(keys, values);
+    assert(fm.size() == 4);
+    assert((fm.keys() == vector<int>{1, 3, 4, 5}));
+    assert(fm.at(1) == "one"); // the first of several equivalent keys wins
+
+    flat_multimap<int, string> fmm(keys, values);
+    assert(fmm.size() == 5);
+    assert(fmm.count(1) == 2);
+    assert(fmm.find(1)->second == "one"); // equivalent keys keep their relative order
+    assert(next(fmm.find(1))->second == "uno");
+
+    const flat_map<int, string> sorted_fm(sorted_unique, {1, 2, 3}, {"a", "b", "c"});
+    assert(sorted_fm.at(2) == "b");
+
+    const flat_map<int, int, greater<int>> from_ilist{{1, 10}, {3, 30}, {2, 20}, {3, 33}};
+    assert((from_ilist.keys() == vector<int>{3, 2, 1}));
+    assert(from_ilist.at(3) == 30);
+
+    const vector<pair<int, int>> pairs{{2, 4}, {1, 1}, {3, 9}};
+    const flat_map<int, int> from_rng(from_range, pairs);
+    assert((from_rng.values() == vector<int>{1, 4, 9}));
+
+    flat_map ctad_iter(pairs.begin(), pairs.end());
+    static_assert(is_same_v<decltype(ctad_iter), flat_map<int, int>>);
+    flat_map ctad_cont(keys, values);
+    static_assert(is_same_v<decltype(ctad_cont), flat_map<int, string>>);
+    flat_multimap ctad_deque(deque<int>{1}, deque<int>{2});
+    static_assert(is_same_v<decltype(ctad_deque), flat_multimap<int, int, less<int>, deque<int>, deque<int>>>);
+
+    const flat_map<int, int, less<int>, deque<int>, deque<int>> with_alloc(
+        pairs.begin(), pairs.end(), allocator<int>{});
+    assert(with_alloc.size() == 3);
+    static_assert(uses_allocator_v<flat_map<int, int>, allocator<int>>);
+}
+
+void test_members() {
+    flat_map<string, int> fm;
+    fm["b"] = 2;
+    fm["a"] = 1;
+    assert(fm.begin()->first == "a");
+
+    assert(fm.try_emplace("c", 3).second);
+    assert(!fm.try_emplace("c", 33).second);
+    assert(fm.at("c") == 3);
+    assert(!fm.insert_or_assign("b", 22).second);
+    assert(fm.at("b") == 22);
+    assert(fm.emplace("d", 4).second);
+    assert(!fm.insert({"d", 44}).second);
+
+    const auto hinted = fm.emplace_hint(fm.end(), "e", 5);
+    assert(hinted->second == 5);
+    assert(fm.emplace_hint(fm.begin(), "0", 0) == fm.begin()); // incorrect hints are still honored
+
+    try {
+        (void) fm.at("missing");
+        assert(false);
+    } catch (const out_of_range&) {
+        // expected
+    }
+
+    for (auto&& [key, value] : fm) {
+        value *= 10;
+    }
+
+    fm.begin()->second = -1;
+    assert(fm.at("0") == -1);
+    assert(fm.at("e") == 50);
+
+    assert(fm.erase("b") == 1);
+    assert(fm.erase("b") == 0);
+    const auto after = fm.erase(fm.find("c"));
+    assert(after->first == "d");
+    assert(fm.lower_bound("c")->first == "d");
+    assert(fm.upper_bound("d")->first == "e");
+    assert(fm.equal_range("a").second->first == "d");
+
+    auto copy = fm;
+    assert(copy == fm);
+    copy["z"] = 26;
+    assert(copy != fm);
+    assert(fm < copy);
+    assert((fm <=> copy) == strong_ordering::less);
+
+    swap(copy, fm);
+    assert(fm.contains("z"));
+    assert(!copy.contains("z"));
+
+    auto [keys, values] = move(fm).extract();
+    assert(fm.empty());
+    assert(keys.size() == 5);
+    assert(values.back() == 26);
+
+    keys.pop_back();
+    values.pop_back();
+    fm.replace(move(keys), move(values));
+    assert(fm.size() == 4);
+    assert(fm.at("e") == 50);
+
+    assert(erase_if(fm, [](const auto& elem) { return elem.second >= 10; }) == 3);
+    assert(fm.size() == 1);
+    assert(fm.begin()->first == "0");
+
+    fm = {{"x", 1}, {"y", 2}};
+    assert(fm.size() == 2);
+    assert(fm.value_comp()(*fm.begin(), *next(fm.begin())));
+}
+
+void test_multimap_members() {
+    flat_multimap<int, char> fmm{{3, 'c'}, {1, 'a'}, {3, 'C'}};
+    fmm.emplace(3, 'x');
+    fmm.insert({1, 'A'});
+    assert(fmm.count(3) == 3);
+    const auto [first, last] = fmm.equal_range(3);
+    string threes;
+    for (auto it = first; it != last; ++it) {
+        threes.push_back(it->second);
+    }
+
+    assert(threes == "cCx");
+    assert(fmm.erase(1) == 2);
+    assert(fmm.size() == 3);
+    assert(fmm.emplace_hint(fmm.begin(), 3, 'h')->second == 'h');
+    assert(fmm.begin()->second == 'h');
+}
+
+void test_iterators() {
+    using It  = flat_map<int, int>::iterator;
+    using CIt = flat_map<int, int>::const_iterator;
+    static_assert(random_access_iterator<It>);
+    static_assert(random_access_iterator<CIt>);
+    static_assert(is_convertible_v<It, CIt>);
+    static_assert(!is_convertible_v<CIt, It>);
+    static_assert(is_same_v<iter_reference_t<It>, pair<const int&, int&>>);
+
+    flat_map<int, int> fm{{1, 1}, {2, 4}, {3, 9}, {4, 16}};
+    const It first = fm.begin();
+    assert(fm.end() - first == 4);
+    assert(first[2].second == 9);
+    assert((first + 3)->first == 4);
+    assert((fm.end() - 1)->second == 16);
+    assert(fm.rbegin()->first == 4);
+    const CIt cfirst = first;
+    assert(cfirst == fm.cbegin());
+    assert(cfirst < fm.cend());
+}
+
+struct throwing_key {
+    int val;
+    static inline int countdown = -1;
+
+    throwing_key(const int val_) : val(val_) {}
+    throwing_key(const throwing_key& other) : val(other.val) {
+        tick();
+    }
+    throwing_key& operator=(const throwing_key& other) {
+        tick();
+        val = other.val;
+        return *this;
+    }
+
+    static void tick() {
+        if (countdown > 0 && --countdown == 0) {
+            throw runtime_error("throwing_key");
+        }
+    }
+
+    friend bool operator<(const throwing_key& left, const throwing_key& right) {
+        return left.val < right.val;
+    }
+};
+
+void test_exception_safety() {
+    flat_map<throwing_key, int> fm;
+    for (int i = 0; i < 100; ++i) {
+        fm.emplace(i, i);
+    }
+
+    vector<pair<throwing_key, int>> batch;
+    for (int i = 0; i < 100; ++i) {
+        batch.emplace_back(200 - i, i);
+    }
+
+    throwing_key::countdown = 150;
+    try {
+        fm.insert(batch.begin(), batch.end());
+        assert(false);
+    } catch (const runtime_error&) {
+        // expected
+    }
+
+    throwing_key::countdown = -1;
+    assert(fm.keys().size() == fm.values().size()); // the container may be emptied, but stays consistent
+    assert(is_sorted(fm.keys().begin(), fm.keys().end()));
+}
+
+struct transparent_less {
+    using is_transparent = int;
+
+    template <class L, class R>
+    bool operator()(const L& left, const R& right) const {
+        return string_view{left} < string_view{right};
+    }
+};
+
+void test_heterogeneous() {
+    flat_map<string, int, transparent_less> fm{{"cat", 1}, {"dog", 2}};
+    const string_view dog = "dog";
+    assert(fm.find(dog)->second == 2);
+    assert(fm.contains("cat"));
+    assert(fm.count(string_view{"cow"}) == 0);
+    assert(fm.at(dog) == 2);
+    fm[string_view{"emu"}] = 3;
+    assert(fm.try_emplace(string_view{"emu"}, 33).second == false);
+    assert(fm.erase(dog) == 1);
+    assert((fm.keys() == vector<string>{"cat", "emu"}));
+}
+
+int main() {
+    test_bulk_insert_against<flat_map<int, int>, map<int, int>>(20);
+    test_bulk_insert_against<flat_multimap<int, int>, multimap<int, int>>(20);
+    test_bulk_insert_against<flat_map<int, int, less<int>, deque<int>, deque<int>>, map<int, int>>(5);
+    test_construction();
+    test_members();
+    test_multimap_members();
+    test_iterators();
+    test_exception_safety();
+    test_heterogeneous();
+}
@@ -0,0 +1,154 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <deque>
+#include <flat_set>
+#include <functional>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class FlatSet, class Ref>
+void test_bulk_insert_against(const int rounds) {
+    FlatSet fs;
+    Ref ref;
+    mt19937 gen{1729};
+    uniform_int_distribution<int> key_dist{0, 500};
+    for (int round = 0; round < rounds; ++round) {
+        vector<int> batch;
+        for (int i = 0; i < 200; ++i) {
+            batch.push_back(key_dist(gen));
+        }
+
+        fs.insert(batch.begin(), batch.end());
+        ref.insert(batch.begin(), batch.end());
+        assert(equal(fs.begin(), fs.end(), ref.begin(), ref.end()));
+
+        sort(batch.begin(), batch.end());
+        if constexpr (is_same_v<Ref, set<int>>) {
+            batch.erase(unique(batch.begin(), batch.end()), batch.end());
+            fs.insert(sorted_unique, batch.begin(), batch.end());
+        } else {
+            fs.insert(sorted_equivalent, batch.begin(), batch.end());
+        }
+
+        ref.insert(batch.begin(), batch.end());
+        assert(equal(fs.begin(), fs.end(), ref.begin(), ref.end()));
+    }
+}
+
+void test_construction() {
+    const flat_set<int> fs(vector<int>{5, 1, 3, 1, 4});
+    assert((fs == flat_set<int>{1, 3, 4, 5}));
+
+    const flat_multiset<int> fms(vector<int>{5, 1, 3, 1, 4});
+    assert(fms.size() == 5);
+    assert(fms.count(1) == 2);
+
+    const flat_set<int, greater<int>> descending{1, 3, 2, 3};
+    assert((vector<int>(descending.begin(), descending.end()) == vector<int>{3, 2, 1}));
+
+    const flat_set<int> sorted_fs(sorted_unique, {1, 2, 3});
+    assert(sorted_fs.size() == 3);
+
+    const vector<int> values{4, 2, 2, 8};
+    const flat_set<int> from_rng(from_range, values);
+    assert((from_rng == flat_set<int>{2, 4, 8}));
+
+    flat_set ctad_iter(values.begin(), values.end());
+    static_assert(is_same_v<decltype(ctad_iter), flat_set<int>>);
+    flat_multiset ctad_cont(deque<int>{3, 1});
+    static_assert(is_same_v<decltype(ctad_cont), flat_multiset<int, less<int>, deque<int>>>);
+
+    const flat_set<int, less<int>, deque<int>> with_alloc(values.begin(), values.end(), allocator<int>{});
+    assert(with_alloc.size() == 3);
+    static_assert(uses_allocator_v<flat_set<int>, allocator<int>>);
+}
+
+void test_members() {
+    flat_set<string> fs;
+    assert(fs.insert("b").second);
+    assert(fs.emplace("a").second);
+    assert(!fs.insert("a").second);
+    assert(*fs.emplace_hint(fs.end(), "c") == "c");
+    assert(fs.emplace_hint(fs.end(), "0") == fs.begin()); // incorrect hints are still honored
+    assert(fs.size() == 4);
+
+    static_assert(is_same_v<flat_set<string>::iterator, flat_set<string>::const_iterator>);
+    assert(fs.lower_bound("b") == fs.find("b"));
+    assert(*fs.upper_bound("b") == "c");
+    assert(fs.equal_range("z").first == fs.end());
+    assert(fs.erase("b") == 1);
+    assert(*fs.erase(fs.begin()) == "a");
+
+    auto copy = fs;
+    assert(copy == fs);
+    copy.insert("d");
+    assert(fs < copy);
+    assert((fs <=> copy) == strong_ordering::less);
+    swap(copy, fs);
+    assert(fs.contains("d"));
+
+    auto cont = move(fs).extract();
+    assert(fs.empty());
+    assert((cont == vector<string>{"a", "c", "d"}));
+    cont.pop_back();
+    fs.replace(move(cont));
+    assert(fs.size() == 2);
+
+    assert(erase_if(fs, [](const string& str) { return str == "c"; }) == 1);
+    assert((fs == flat_set<string>{"a"}));
+
+    fs = {"y", "x"};
+    assert(*fs.begin() == "x");
+}
+
+void test_multiset_members() {
+    flat_multiset<int> fms{3, 1, 3};
+    fms.insert(3);
+    fms.emplace_hint(fms.begin(), 1);
+    assert(fms.count(3) == 3);
+    assert(fms.erase(3) == 3);
+    assert((vector<int>(fms.begin(), fms.end()) == vector<int>{1, 1}));
+}
+
+struct transparent_less {
+    using is_transparent = int;
+
+    template <class L, class R>
+    bool operator()(const L& left, const R& right) const {
+        return string_view{left} < string_view{right};
+    }
+};
+
+void test_heterogeneous() {
+    flat_set<string, transparent_less> fs{"cat", "dog"};
+    const string_view dog = "dog";
+    assert(*fs.find(dog) == "dog");
+    assert(fs.contains("cat"));
+    assert(fs.count(string_view{"cow"}) == 0);
+    assert(fs.insert(string_view{"emu"}).second);
+    assert(fs.erase(dog) == 1);
+    assert((fs == flat_set<string, transparent_less>{"cat", "emu"}));
+}
+
+int main() {
+    test_bulk_insert_against<flat_set<int>, set<int>>(20);
+    test_bulk_insert_against<flat_multiset<int>, multiset<int>>(20);
+    test_bulk_insert_against<flat_set<int, less<int>, deque<int>>, set<int>>(5);
+    test_construction();
+    test_members();
+    test_multiset_members();
+    test_heterogeneous();
+}
@@ -0,0 +1,204 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <new>
+#include <node_cache>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using stdext::node_cache;
+using stdext::node_cache_allocator;
+
+size_t heap_allocations = 0;
+
+void* operator new(const size_t size) {
+    ++heap_allocations;
+    if (void* const ptr = malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw bad_alloc{};
+}
+
+void operator delete(void* const ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* const ptr, size_t) noexcept {
+    free(ptr);
+}
+
+static_assert(allocator_traits<node_cache_allocator<int>>::is_always_equal::value);
+static_assert(
+    is_same_v<allocator_traits<node_cache_allocator<int>>::rebind_alloc<string>, node_cache_allocator<string>>);
+
+template <class Cont, class Fill>
+void test_refill_reuses_nodes(Fill fill) {
+    node_cache cache;
+    {
+        Cont cont(&cache);
+        for (int cycle = 0; cycle < 4; ++cycle) {
+            const size_t allocations_before = heap_allocations;
+            fill(cont);
+            if (cycle >= 2) { // the first cycles may still grow unordered containers' buckets
+                assert(heap_allocations == allocations_before);
+            }
+
+            cont.clear();
+            assert(cache.cached_blocks() >= 100);
+        }
+
+        assert(cont.get_allocator().cache() == &cache);
+    }
+
+    assert(cache.cached_blocks() >= 100); // destroying the container keeps its nodes in the cache
+    cache.release();
+    assert(cache.cached_blocks() == 0);
+}
+
+void test_containers() {
+    test_refill_reuses_nodes<map<int, int, less<int>, node_cache_allocator<pair<const int, int>>>>([](auto& cont) {
+        for (int i = 0; i < 100; ++i) {
+            cont.emplace(i, i);
+        }
+    });
+
+    test_refill_reuses_nodes<multiset<int, less<int>, node_cache_allocator<int>>>([](auto& cont) {
+        for (int i = 0; i < 100; ++i) {
+            cont.insert(i % 10);
+        }
+    });
+
+    test_refill_reuses_nodes<list<int, node_cache_allocator<int>>>([](auto& cont) { cont.assign(100, 42); });
+
+    test_refill_reuses_nodes<forward_list<int, node_cache_allocator<int>>>([](auto& cont) {
+        for (int i = 0; i < 100; ++i) {
+            cont.push_front(i);
+        }
+    });
+
+    test_refill_reuses_nodes<
+        unordered_map<int, int, hash<int>, equal_to<int>, node_cache_allocator<pair<const int, int>>>>([](auto& cont) {
+        for (int i = 0; i < 100; ++i) {
+            cont.emplace(i, i);
+        }
+    });
+
+    test_refill_reuses_nodes<unordered_multiset<int, hash<int>, equal_to<int>, node_cache_allocator<int>>>(
+        [](auto& cont) {
+            for (int i = 0; i < 100; ++i) {
+                cont.insert(i % 10);
+            }
+        });
+}
+
+void test_high_water() {
+    node_cache cache{10};
+    assert(cache.high_water() == 10);
+    {
+        list<int, node_cache_allocator<int>> lst(&cache);
+        lst.assign(50, 1);
+        lst.clear();
+        assert(cache.cached_blocks() == 10); // the rest went back to the heap
+
+        lst.assign(5, 1);
+        assert(cache.cached_blocks() == 5);
+        lst.clear();
+        assert(cache.cached_blocks() == 10);
+    }
+
+    cache.set_high_water(3);
+    assert(cache.cached_blocks() == 3);
+    cache.set_high_water(0);
+    assert(cache.cached_blocks() == 0);
+
+    list<int, node_cache_allocator<int>> uncached(&cache);
+    uncached.assign(5, 1);
+    uncached.clear();
+    assert(cache.cached_blocks() == 0);
+    assert(node_cache::default_high_water == node_cache{}.high_water());
+}
+
+void test_mixing_caches() {
+    // every block comes from the heap, so nodes may move between containers using different caches, or none
+    node_cache first_cache;
+    node_cache second_cache;
+    {
+        list<string, node_cache_allocator<string>> first(&first_cache);
+        list<string, node_cache_allocator<string>> second(&second_cache);
+        list<string, node_cache_allocator<string>> third;
+        assert(first.get_allocator() == second.get_allocator());
+        assert(third.get_allocator().cache() == nullptr);
+
+        first.assign(20, "meow");
+        second.splice(second.end(), first);
+        third.splice(third.end(), second, second.begin());
+        swap(first, third);
+        assert(first.size() == 1);
+        assert(second.size() == 19);
+
+        second = move(first);
+        assert(second.get_allocator().cache() == &first_cache); // propagated on move assignment
+    }
+
+    assert(first_cache.cached_blocks() + second_cache.cached_blocks() != 0);
+
+    map<int, vector<int>, less<int>, node_cache_allocator<pair<const int, vector<int>>>> source(&first_cache);
+    source[1].push_back(1);
+    source[2].push_back(2);
+    map<int, vector<int>, less<int>, node_cache_allocator<pair<const int, vector<int>>>> target(&second_cache);
+    target.merge(source);
+    assert(target.size() == 2);
+    auto node = target.extract(1);
+    source.insert(move(node));
+    assert(source.at(1).front() == 1);
+}
+
+void test_allocator() {
+    node_cache cache;
+    node_cache_allocator<int> alloc(&cache);
+    const node_cache_allocator<double> rebound(alloc);
+    assert(rebound.cache() == &cache);
+    assert(rebound == alloc);
+
+    int* const single = alloc.allocate(1);
+    alloc.deallocate(single, 1);
+    assert(cache.cached_blocks() == 1);
+    assert(alloc.allocate(1) == single); // the cached block is handed out again
+    alloc.deallocate(single, 1);
+
+    int* const array = alloc.allocate(100); // arrays always come from the heap
+    alloc.deallocate(array, 100);
+    assert(cache.cached_blocks() == 1);
+
+    struct alignas(64) over_aligned {
+        char bytes[64];
+    };
+    node_cache_allocator<over_aligned> aligned_alloc(&cache);
+    over_aligned* const aligned = aligned_alloc.allocate(1);
+    assert(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+    aligned_alloc.deallocate(aligned, 1);
+    assert(cache.cached_blocks() == 1);
+}
+
+int main() {
+    test_containers();
+    test_high_water();
+    test_mixing_caches();
+    test_allocator();
+}
@@ -0,0 +1,554 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <flat_hash_map>
+#include <flat_hash_set>
+#include <functional>
+#include <memory>
+#include <node_hash_map>
+#include <node_hash_set>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using stdext::flat_hash_map;
+using stdext::flat_hash_set;
+using stdext::node_hash_map;
+using stdext::node_hash_set;
+
+static size_t live_allocations = 0;
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) {}
+
+    T* allocate(const size_t n) {
+        ++live_allocations;
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) {
+        assert(live_allocations != 0);
+        --live_allocations;
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>&) const noexcept {
+        return true;
+    }
+
+#if !_HAS_CXX20
+    template <class U>
+    bool operator!=(const counting_allocator<U>&) const noexcept {
+        return false;
+    }
+#endif // !_HAS_CXX20
+};
+
+struct bad_hash { // forces every key into the same probe sequence or bucket
+    size_t operator()(int) const noexcept {
+        return 0;
+    }
+};
+
+static size_t hash_calls = 0;
+
+struct counting_hash {
+    size_t operator()(const int key) const noexcept {
+        ++hash_calls;
+        return hash<int>{}(key);
+    }
+};
+
+// node_hash_map and node_hash_set expose their buckets; flat_hash_map and flat_hash_set don't have any
+template <class Cont, class = void>
+constexpr bool has_buckets = false;
+
+template <class Cont>
+constexpr bool has_buckets<Cont, void_t<decltype(declval<const Cont&>().bucket_count())>> = true;
+
+template <class Cont>
+void assert_invariants(const Cont& c) {
+    if constexpr (has_buckets<Cont>) {
+        const size_t buckets = c.bucket_count();
+        assert(buckets == 0 || (buckets & (buckets - 1)) == 0);
+        size_t total = 0;
+        for (size_t bucket = 0; bucket < buckets; ++bucket) {
+            total += c.bucket_size(bucket);
+        }
+
+        assert(total == c.size());
+        for (const auto& elem : c) {
+            if constexpr (is_same_v<typename Cont::key_type, typename Cont::value_type>) {
+                assert(c.bucket_size(c.bucket(elem)) != 0);
+            } else {
+                assert(c.bucket_size(c.bucket(elem.first)) != 0);
+            }
+        }
+    }
+
+    assert(static_cast<size_t>(distance(c.begin(), c.end())) == c.size());
+    assert(c.load_factor() <= c.max_load_factor());
+}
+
+template <class Map, class Ref>
+void assert_same_contents(const Map& m, const Ref& ref) {
+    assert(m.size() == ref.size());
+    assert(m.empty() == ref.empty());
+    for (const auto& [key, value] : ref) {
+        const auto it = m.find(key);
+        assert(it != m.end());
+        assert(it->second == value);
+    }
+
+    for (const auto& [key, value] : m) {
+        assert(ref.at(key) == value);
+    }
+
+    assert_invariants(m);
+}
+
+template <class Map>
+void test_against_unordered_map() {
+    Map m;
+    unordered_map<int, int> ref;
+    mt19937 gen{1729};
+    uniform_int_distribution<int> key_dist{0, 3000};
+    uniform_int_distribution<int> op_dist{0, 9};
+    for (int i = 0; i < 40'000; ++i) {
+        const int key = key_dist(gen);
+        switch (op_dist(gen)) {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+            {
+                const auto [it, inserted] = m.emplace(key, i);
+                assert(inserted == ref.emplace(key, i).second);
+                assert(it->first == key);
+                assert(it->second == ref[key]);
+                break;
+            }
+        case 4:
+        case 5:
+        case 6:
+            assert(m.erase(key) == ref.erase(key));
+            break;
+        case 7:
+            m.insert_or_assign(key, i);
+            ref[key] = i;
+            break;
+        case 8:
+            assert(m.count(key) == ref.count(key));
+            assert(m.contains(key) == (ref.find(key) != ref.end()));
+            break;
+        default:
+            if (!m.empty()) { // erase the first element through an iterator
+                const int first_key = m.begin()->first;
+                const auto next     = m.erase(m.begin());
+                assert(next == m.begin());
+                assert(ref.erase(first_key) == 1);
+            }
+            break;
+        }
+
+        if (i % 5000 == 0) {
+            assert_same_contents(m, ref);
+        }
+    }
+
+    assert_same_contents(m, ref);
+
+    m.clear();
+    assert(m.empty());
+    assert(m.begin() == m.end());
+    assert(m.find(0) == m.end());
+    assert_invariants(m);
+}
+
+template <template <class...> class HashMap>
+void test_map_members() {
+    HashMap<string, int> m;
+    assert(m.begin() == m.end());
+    if constexpr (has_buckets<HashMap<string, int>>) {
+        assert(m.bucket_count() == 0);
+    }
+
+    assert(m.find("missing") == m.end());
+    assert(m.erase("missing") == 0);
+
+    m["one"] = 1;
+    m["two"] = 2;
+    assert(m.at("one") == 1);
+    assert(m.size() == 2);
+
+    const string three = "three";
+    assert(m.try_emplace(three, 3).second);
+    assert(!m.try_emplace(three, 33).second);
+    assert(m.at(three) == 3);
+
+    assert(!m.insert_or_assign("two", 22).second);
+    assert(m.at("two") == 22);
+
+    assert(m.emplace(piecewise_construct, forward_as_tuple("four"), forward_as_tuple(4)).second);
+    assert(!m.insert(pair<const string, int>{"four", 44}).second);
+    assert(m.at("four") == 4);
+
+    try {
+        (void) m.at("five");
+        assert(false);
+    } catch (const out_of_range&) {
+        // expected
+    }
+
+    // a value constructed from an element must survive the rehash triggered by its own insertion
+    for (int i = 0; i < 1000; ++i) {
+        m.try_emplace(to_string(i + 10), m.at("one"));
+        m.emplace(to_string(-i), m.find("two")->second);
+    }
+
+    assert(m.size() == 2004);
+    assert(m.at("500") == 1);
+
+    auto copy = m;
+    assert(copy == m);
+    if constexpr (has_buckets<HashMap<string, int>>) {
+        assert(copy.bucket_count() == m.bucket_count());
+    }
+
+    assert_invariants(copy);
+    copy["one"] = 100;
+    assert(copy != m);
+
+    auto moved = move(copy);
+    assert(moved.at("one") == 100);
+    assert_invariants(moved);
+    swap(moved, m);
+    assert(m.at("one") == 100);
+    assert(moved.at("one") == 1);
+    assert_invariants(m);
+    assert_invariants(moved);
+
+    m = {{"a", 1}, {"b", 2}};
+    assert(m.size() == 2);
+    assert(m.at("b") == 2);
+
+    const auto hasher = m.hash_function();
+    assert(hasher("a") == hash<string>{}("a"));
+    assert(m.key_eq()("a", "a"));
+}
+
+template <template <class...> class HashSet>
+void test_set_members() {
+    HashSet<int> s{5, 3, 5, 1};
+    assert(s.size() == 3);
+    assert(s.contains(3));
+    assert(!s.contains(4));
+
+    vector<int> values(1000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i % 700);
+    }
+
+    s.insert_range(values);
+    assert(s.size() == 700);
+    assert_invariants(s);
+
+    for (auto it = s.begin(); it != s.end();) {
+        if (*it % 2 == 0) {
+            it = s.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    for (const int value : s) {
+        assert(value % 2 != 0);
+    }
+
+    assert(s.size() == 350);
+    assert_invariants(s);
+
+    HashSet<int> rebuilt(s.begin(), s.end());
+    assert(rebuilt == s);
+
+    const size_t erased = erase_if(rebuilt, [](const int value) { return value % 3 == 0; });
+    assert(erased != 0);
+    assert(rebuilt.size() + erased == s.size());
+    for (const int value : rebuilt) {
+        assert(value % 3 != 0);
+    }
+
+    assert_invariants(rebuilt);
+    vector<int> contents(s.begin(), s.end());
+    sort(contents.begin(), contents.end());
+    assert(adjacent_find(contents.begin(), contents.end()) == contents.end());
+
+    auto tail = s;
+    tail.erase(tail.find(5), tail.end());
+    assert(!tail.contains(5));
+    assert(tail.size() < s.size());
+    assert_invariants(tail);
+
+    s.erase(s.begin(), s.end());
+    assert(s.empty());
+    assert_invariants(s);
+}
+
+void test_flat_reserve() {
+    flat_hash_map<int, int> m;
+    m.reserve(1000);
+    const size_t capacity = m.capacity();
+    assert(capacity >= 1000);
+    m.emplace(0, 0);
+    const auto first = &*m.find(0);
+    for (int i = 1; i < 1000; ++i) {
+        m.emplace(i, i);
+    }
+
+    assert(m.capacity() == capacity); // no rehash happened
+    assert(&*m.find(0) == first);
+
+    // tombstones left by erasure are reclaimed without unbounded growth
+    for (int round = 0; round < 50; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+            assert(m.erase(i + round * 1000) == 1);
+            assert(m.emplace(i + (round + 1) * 1000, i).second);
+        }
+    }
+
+    assert(m.size() == 1000);
+    assert(m.capacity() == capacity);
+
+    m.rehash(0);
+    assert(m.capacity() >= 1000);
+    assert(m.at(50'500) == 500);
+}
+
+void test_node_rehash() {
+    node_hash_map<int, int, counting_hash> m;
+    for (int i = 0; i < 1000; ++i) {
+        m.emplace(i, i);
+    }
+
+    // references and iterators stay valid across rehashing
+    const auto first     = &*m.find(0);
+    const auto first_it  = m.find(0);
+    const size_t buckets = m.bucket_count();
+    assert(buckets >= 1000);
+
+    // the cached hashes spare rehashing, copying and iterating from calling the hasher
+    hash_calls = 0;
+    m.rehash(buckets * 8);
+    assert(m.bucket_count() == buckets * 8);
+    m.rehash(0); // shrinks back as far as the maximum load factor allows
+    assert(m.bucket_count() == 1024);
+    auto copy = m;
+    assert(hash_calls == 0);
+    assert_invariants(m);
+    assert_invariants(copy);
+
+    assert(&*m.find(0) == first);
+    assert(m.find(0) == first_it);
+
+    m.max_load_factor(4.0f);
+    assert(m.max_load_factor() == 4.0f);
+    m.rehash(0);
+    assert(m.bucket_count() == 256);
+    assert_invariants(m);
+
+    m.reserve(5000);
+    assert(static_cast<float>(m.bucket_count()) * m.max_load_factor() >= 5000.0f);
+    const size_t reserved = m.bucket_count();
+    for (int i = 1000; i < 5000; ++i) {
+        m.emplace(i, i);
+    }
+
+    assert(m.bucket_count() == reserved); // no rehash happened
+    assert(&m.at(0) == &first->second);
+    assert_invariants(m);
+
+    node_hash_set<int> sized(100);
+    assert(sized.bucket_count() == 128);
+}
+
+template <template <class...> class HashMap>
+void test_collisions() {
+    HashMap<int, int, bad_hash> m;
+    for (int i = 0; i < 200; ++i) {
+        m.emplace(i, -i);
+    }
+
+    if constexpr (has_buckets<HashMap<int, int, bad_hash>>) {
+        assert(m.bucket_size(0) == 200);
+    }
+
+    for (int i = 0; i < 200; i += 2) {
+        assert(m.erase(i) == 1);
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        assert(m.contains(i) == (i % 2 != 0));
+    }
+
+    assert_invariants(m);
+}
+
+template <template <class...> class HashMap>
+void test_allocator() {
+    {
+        HashMap<int, string, hash<int>, equal_to<int>, counting_allocator<pair<const int, string>>> m;
+        for (int i = 0; i < 500; ++i) {
+            m.emplace(i, string(40, 'x'));
+        }
+
+        auto copy = m;
+        copy.erase(7);
+        auto moved = move(m);
+        assert(moved.size() == 500);
+        assert(copy.size() == 499);
+        moved = copy;
+        assert(moved == copy);
+        assert(live_allocations != 0);
+    }
+
+    assert(live_allocations == 0);
+}
+
+struct throwing_copy {
+    static inline int countdown = -1;
+
+    throwing_copy() = default;
+    throwing_copy(const throwing_copy&) {
+        if (countdown > 0 && --countdown == 0) {
+            throw runtime_error("throwing_copy");
+        }
+    }
+    throwing_copy& operator=(const throwing_copy&) = default;
+};
+
+struct throwing_value {
+    static inline int countdown = -1;
+
+    explicit throwing_value(const int) {
+        if (countdown > 0 && --countdown == 0) {
+            throw runtime_error("throwing_value");
+        }
+    }
+};
+
+template <template <class...> class HashMap>
+void test_exception_safety() {
+    using map_type =
+        HashMap<int, throwing_copy, hash<int>, equal_to<int>, counting_allocator<pair<const int, throwing_copy>>>;
+    {
+        map_type m;
+        for (int i = 0; i < 100; ++i) {
+            m.try_emplace(i);
+        }
+
+        const size_t allocations = live_allocations;
+        throwing_copy::countdown = 50;
+        try {
+            map_type copy(m);
+            assert(false);
+        } catch (const runtime_error&) {
+            // expected
+        }
+
+        assert(live_allocations == allocations);
+        throwing_copy::countdown = 50;
+        try {
+            map_type copy(m, m.get_allocator());
+            assert(false);
+        } catch (const runtime_error&) {
+            // expected
+        }
+
+        throwing_copy::countdown = -1;
+        assert(live_allocations == allocations);
+        assert(m.size() == 100);
+    }
+
+    assert(live_allocations == 0);
+
+    HashMap<int, throwing_value> m;
+    for (int i = 0; i < 100; ++i) {
+        m.try_emplace(i, i);
+    }
+
+    throwing_value::countdown = 50;
+    try {
+        for (int i = 100; i < 200; ++i) {
+            m.try_emplace(i, i);
+        }
+
+        assert(false);
+    } catch (const runtime_error&) {
+        // expected
+    }
+
+    throwing_value::countdown = -1;
+    assert(m.size() == 149);
+    assert(!m.contains(149));
+    assert_invariants(m);
+}
+
+#if _HAS_CXX20
+struct transparent_hash {
+    using is_transparent = int;
+
+    size_t operator()(const string_view sv) const noexcept {
+        return hash<string_view>{}(sv);
+    }
+};
+
+template <template <class...> class HashMap, template <class...> class HashSet>
+void test_heterogeneous_lookup() {
+    HashMap<string, int, transparent_hash, equal_to<>> m{{"cat", 1}, {"dog", 2}};
+    const string_view dog = "dog";
+    assert(m.find(dog)->second == 2);
+    assert(m.contains("cat"));
+    assert(m.count(string_view{"cow"}) == 0);
+
+    const HashSet<string, transparent_hash, equal_to<>> s{"red", "green"};
+    assert(s.contains(string_view{"green"}));
+    assert(s.find("blue") == s.end());
+}
+#endif // _HAS_CXX20
+
+template <template <class...> class HashMap, template <class...> class HashSet>
+void test_containers() {
+    test_against_unordered_map<HashMap<int, int>>();
+    test_against_unordered_map<HashMap<int, int, bad_hash>>();
+    test_map_members<HashMap>();
+    test_set_members<HashSet>();
+    test_collisions<HashMap>();
+    test_allocator<HashMap>();
+    test_exception_safety<HashMap>();
+#if _HAS_CXX20
+    test_heterogeneous_lookup<HashMap, HashSet>();
+#endif // _HAS_CXX20
+}
+
+int main() {
+    test_containers<flat_hash_map, flat_hash_set>();
+    test_flat_reserve();
+
+    test_containers<node_hash_map, node_hash_set>();
+    test_node_rehash();
+}
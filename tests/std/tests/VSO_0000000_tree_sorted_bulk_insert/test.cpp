@@ -0,0 +1,321 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// Ranges are inserted in sorted runs that are linked into the tree in linear time; the results must be
+// indistinguishable from inserting the elements one at a time.
+
+template <class Tree>
+void assert_valid(const Tree& tree) {
+    assert(static_cast<size_t>(distance(tree.begin(), tree.end())) == tree.size());
+    assert(static_cast<size_t>(distance(tree.rbegin(), tree.rend())) == tree.size());
+    assert(is_sorted(tree.begin(), tree.end(), tree.value_comp()));
+}
+
+template <class Tree>
+Tree one_at_a_time(const Tree& start, const vector<pair<int, int>>& elements) {
+    Tree result(start);
+    for (const auto& elem : elements) {
+        result.insert(result.end(), elem);
+    }
+
+    return result;
+}
+
+template <class Tree>
+void test_against_one_at_a_time() {
+    mt19937 gen{1729};
+    for (int round = 0; round < 200; ++round) {
+        Tree tree;
+        const int key_limit = uniform_int_distribution<int>{1, 1000}(gen);
+        for (int batch = 0; batch < 5; ++batch) {
+            vector<pair<int, int>> elements;
+            const int count = uniform_int_distribution<int>{0, 300}(gen);
+            uniform_int_distribution<int> key_dist{0, key_limit};
+            for (int i = 0; i < count; ++i) {
+                elements.emplace_back(key_dist(gen), round * 10000 + batch * 1000 + i);
+            }
+
+            switch (gen() % 4) {
+            case 0:
+                break;
+            case 1:
+                stable_sort(elements.begin(), elements.end(),
+                    [](const pair<int, int>& left, const pair<int, int>& right) { return left.first < right.first; });
+                break;
+            case 2: // sorted except for one element near the end
+                stable_sort(elements.begin(), elements.end(),
+                    [](const pair<int, int>& left, const pair<int, int>& right) { return left.first < right.first; });
+                if (count > 2) {
+                    swap(elements[count - 2].first, elements[0].first);
+                }
+                break;
+            default: // sorted with many equivalent keys
+                for (auto& elem : elements) {
+                    elem.first /= 16;
+                }
+
+                stable_sort(elements.begin(), elements.end(),
+                    [](const pair<int, int>& left, const pair<int, int>& right) { return left.first < right.first; });
+                break;
+            }
+
+            const Tree expected = one_at_a_time(tree, elements);
+            const auto kept     = tree.begin();
+            const bool had_kept = !tree.empty();
+            const auto kept_val = had_kept ? *kept : pair<const int, int>{};
+            tree.insert(elements.begin(), elements.end());
+            assert_valid(tree);
+            assert(tree == expected); // also compares mapped values, which tell equivalent keys apart
+            if (had_kept) {
+                assert(*kept == kept_val); // iterators stay valid when the tree is relinked
+            }
+        }
+    }
+}
+
+void test_short_run_after_equivalents() {
+    // a run too short to pay for relinking the tree is inserted node by node; equivalent keys already in the
+    // tree must still come first
+    multimap<int, char> tree;
+    for (int key = 0; key < 1000; ++key) {
+        tree.emplace(key, 'x');
+    }
+
+    const pair<int, char> run[] = {{2, 'b'}, {5, 'y'}, {5, 'z'}, {7, 'c'}, {7, 'd'}, {8, 'e'}};
+    tree.insert(begin(run), end(run));
+    assert_valid(tree);
+    assert(tree.size() == 1006);
+
+    const auto check_order = [&](const int key, const char* const expected) {
+        auto first = tree.lower_bound(key);
+        for (const char* p = expected; *p != '\0'; ++p, ++first) {
+            assert(first != tree.end() && first->first == key && first->second == *p);
+        }
+
+        assert(first == tree.upper_bound(key));
+    };
+
+    check_order(2, "xb");
+    check_order(5, "xyz");
+    check_order(7, "xcd");
+    check_order(8, "xe");
+}
+
+void test_construction() {
+    vector<int> values(1000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i / 2);
+    }
+
+    const set<int> unique_keys(values.begin(), values.end());
+    assert(unique_keys.size() == 500);
+    assert(*unique_keys.begin() == 0);
+    assert(*unique_keys.rbegin() == 499);
+    assert_valid(unique_keys);
+
+    const multiset<int> equivalent_keys(values.begin(), values.end());
+    assert(equivalent_keys.size() == 1000);
+    assert(equivalent_keys.count(250) == 2);
+    assert_valid(equivalent_keys);
+
+    const set<int, greater<int>> descending(values.rbegin(), values.rend());
+    assert(*descending.begin() == 499);
+    assert_valid(descending);
+
+    const map<int, char> from_ilist{{1, 'a'}, {2, 'b'}, {2, 'x'}, {3, 'c'}, {0, 'z'}};
+    assert(from_ilist.size() == 4);
+    assert(from_ilist.at(2) == 'b');
+    assert(from_ilist.begin()->second == 'z');
+
+    for (size_t size = 0; size < 70; ++size) { // every shape of the deepest level
+        const set<int> small(values.begin(), values.begin() + static_cast<ptrdiff_t>(2 * size));
+        assert(small.size() == size);
+        assert_valid(small);
+    }
+}
+
+struct throwing_less {
+    static int countdown;
+
+    bool operator()(const int left, const int right) const {
+        if (countdown > 0 && --countdown == 0) {
+            throw runtime_error("throwing_less");
+        }
+
+        return left < right;
+    }
+};
+
+int throwing_less::countdown = -1;
+
+struct counted {
+    static int live;
+    static int countdown;
+    int val;
+
+    counted(const int val_) : val(val_) {
+        ++live;
+    }
+    counted(const counted& other) : val(other.val) {
+        if (countdown > 0 && --countdown == 0) {
+            throw runtime_error("counted");
+        }
+
+        ++live;
+    }
+    counted& operator=(const counted&) = default;
+    ~counted() {
+        --live;
+    }
+
+    friend bool operator<(const counted& left, const counted& right) noexcept {
+        return left.val < right.val;
+    }
+};
+
+int counted::live      = 0;
+int counted::countdown = -1;
+
+void test_exception_safety() {
+    for (int throw_at = 1; throw_at < 300; throw_at += 7) {
+        vector<counted> elements;
+        for (int i = 0; i < 200; ++i) {
+            elements.emplace_back(i % 150 * 2);
+        }
+
+        set<counted> tree(elements.begin(), elements.begin() + 100);
+        counted::countdown = throw_at;
+        try {
+            tree.insert(elements.begin() + 100, elements.end());
+        } catch (const runtime_error&) {
+            // expected for most throw_at values
+        }
+
+        counted::countdown = -1;
+        assert_valid(tree);
+        assert(counted::live == static_cast<int>(elements.size() + tree.size())); // nothing leaked
+    }
+
+    for (int throw_at = 1; throw_at < 1000; throw_at += 13) {
+        vector<int> elements;
+        for (int i = 0; i < 300; ++i) {
+            elements.push_back(i * 3 % 500);
+        }
+
+        sort(elements.begin() + 100, elements.end());
+        multiset<int, throwing_less> tree(elements.begin(), elements.begin() + 100);
+        throwing_less::countdown = throw_at;
+        try {
+            tree.insert(elements.begin() + 100, elements.end());
+        } catch (const runtime_error&) {
+            // expected for most throw_at values
+        }
+
+        throwing_less::countdown = -1;
+        assert_valid(tree);
+        assert(tree.size() >= 100);
+    }
+}
+
+#if _HAS_CXX17
+void test_merge() {
+    {
+        set<int> target{0, 2, 4, 6};
+        set<int> source{1, 2, 3, 4, 5};
+        const auto moved = source.find(3);
+        target.merge(source);
+        assert((target == set<int>{0, 1, 2, 3, 4, 5, 6}));
+        assert((source == set<int>{2, 4})); // equivalent elements stay behind
+        assert_valid(target);
+        assert_valid(source);
+        assert(target.find(3) == moved); // iterators follow their elements
+    }
+
+    {
+        multimap<int, char> target{{1, 'a'}, {2, 'b'}};
+        multimap<int, char> source{{1, 'x'}, {2, 'y'}, {2, 'z'}, {3, 'w'}};
+        target.merge(source);
+        assert(source.empty());
+        const multimap<int, char> expected{{1, 'a'}, {1, 'x'}, {2, 'b'}, {2, 'y'}, {2, 'z'}, {3, 'w'}};
+        assert(target == expected); // merged elements go after equivalent elements already present
+        assert_valid(target);
+    }
+
+    {
+        set<int> target{5, 10};
+        set<int, greater<int>> source{1, 5, 7, 12}; // sorted the other way
+        target.merge(source);
+        assert((target == set<int>{1, 5, 7, 10, 12}));
+        assert((source == set<int, greater<int>>{5}));
+        assert_valid(target);
+        assert_valid(source);
+    }
+
+    mt19937 gen{42};
+    for (int round = 0; round < 100; ++round) {
+        uniform_int_distribution<int> key_dist{0, 400};
+        set<int> target;
+        multiset<int> multi_target;
+        set<int> source;
+        const int target_size = uniform_int_distribution<int>{0, 300}(gen);
+        const int source_size = uniform_int_distribution<int>{0, 300}(gen);
+        for (int i = 0; i < target_size; ++i) {
+            const int key = key_dist(gen);
+            target.insert(key);
+            multi_target.insert(key);
+        }
+
+        for (int i = 0; i < source_size; ++i) {
+            source.insert(key_dist(gen));
+        }
+
+        set<int> expected_target(target);
+        set<int> expected_source;
+        for (const int key : source) {
+            if (!expected_target.insert(key).second) {
+                expected_source.insert(key);
+            }
+        }
+
+        multiset<int> expected_multi(multi_target);
+        expected_multi.insert(source.begin(), source.end());
+        set<int> multi_source(source);
+
+        target.merge(source);
+        assert(target == expected_target);
+        assert(source == expected_source);
+        assert_valid(target);
+        assert_valid(source);
+
+        multi_target.merge(multi_source);
+        assert(multi_target == expected_multi);
+        assert(multi_source.empty());
+        assert_valid(multi_target);
+    }
+}
+#endif // _HAS_CXX17
+
+int main() {
+    test_against_one_at_a_time<map<int, int>>();
+    test_against_one_at_a_time<multimap<int, int>>();
+    test_short_run_after_equivalents();
+    test_construction();
+    test_exception_safety();
+#if _HAS_CXX17
+    test_merge();
+#endif // _HAS_CXX17
+}
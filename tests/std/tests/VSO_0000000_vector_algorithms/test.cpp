@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
 #include <algorithm>
+#include <bitset>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
@@ -11,7 +13,10 @@
 #include <isa_availability.h>
 #include <limits>
 #include <list>
+#include <memory>
 #include <random>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -161,6 +166,259 @@ void test_find_last(mt19937_64& gen) {
 }
 #endif // _HAS_CXX23 && defined(__cpp_lib_concepts)
 
+template <class FwdIt1, class FwdIt2>
+FwdIt1 last_known_good_search(FwdIt1 first1, FwdIt1 last1, FwdIt2 first2, FwdIt2 last2) {
+    for (;; ++first1) {
+        FwdIt1 mid1 = first1;
+        for (FwdIt2 mid2 = first2;; ++mid1, (void) ++mid2) {
+            if (mid2 == last2) {
+                return first1;
+            } else if (mid1 == last1) {
+                return last1;
+            } else if (*mid1 != *mid2) {
+                break;
+            }
+        }
+    }
+}
+
+template <class T>
+void test_case_search(const vector<T>& input, const vector<T>& needle) {
+    auto expected = last_known_good_search(input.begin(), input.end(), needle.begin(), needle.end());
+    auto actual   = search(input.begin(), input.end(), needle.begin(), needle.end());
+    assert(expected == actual);
+#ifdef __cpp_lib_concepts
+    auto range = ranges::search(input, needle);
+    assert(expected == range.begin());
+    if (expected == input.end()) {
+        assert(range.end() == input.end());
+    } else {
+        assert(range.end() == expected + static_cast<ptrdiff_t>(needle.size()));
+    }
+#endif // defined(__cpp_lib_concepts)
+}
+
+template <class T>
+void test_search(mt19937_64& gen) {
+    using TD = conditional_t<sizeof(T) == 1, int, T>;
+    uniform_int_distribution<TD> dis('0', '2'); // small alphabet, so that partial matches are frequent
+    uniform_int_distribution<size_t> needle_size_dis(0, 9);
+    vector<T> input;
+    vector<T> needle;
+    input.reserve(dataCount);
+    test_case_search(input, needle);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        needle.resize(needle_size_dis(gen));
+        for (auto& e : needle) {
+            e = static_cast<T>(dis(gen));
+        }
+        test_case_search(input, needle);
+    }
+}
+
+template <class C>
+void test_case_string_find(const basic_string<C>& input, const basic_string<C>& needle, const size_t start) {
+    size_t expected = basic_string<C>::npos;
+    if (start <= input.size()) {
+        const auto it = last_known_good_search(input.begin() + static_cast<ptrdiff_t>(start), input.end(),
+            needle.begin(), needle.end());
+        if (needle.empty() || it != input.end()) {
+            expected = static_cast<size_t>(it - input.begin());
+        }
+    }
+
+    assert(input.find(needle, start) == expected);
+    assert(input.find(needle.c_str(), start, needle.size()) == expected);
+}
+
+template <class C>
+void test_string_find(mt19937_64& gen) {
+    uniform_int_distribution<int> dis('0', '2');
+    uniform_int_distribution<size_t> needle_size_dis(0, 9);
+    basic_string<C> input;
+    basic_string<C> needle;
+    test_case_string_find(input, needle, 0);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<C>(dis(gen)));
+        needle.resize(needle_size_dis(gen));
+        for (auto& e : needle) {
+            e = static_cast<C>(dis(gen));
+        }
+        test_case_string_find(input, needle, 0);
+        test_case_string_find(input, needle, input.size() / 2);
+        test_case_string_find(input, needle, input.size() + 1);
+    }
+}
+
+template <class FwdIt1, class FwdIt2>
+FwdIt1 last_known_good_find_first_of(FwdIt1 first1, FwdIt1 last1, FwdIt2 first2, FwdIt2 last2) {
+    for (; first1 != last1; ++first1) {
+        for (FwdIt2 mid2 = first2; mid2 != last2; ++mid2) {
+            if (*first1 == *mid2) {
+                return first1;
+            }
+        }
+    }
+
+    return first1;
+}
+
+template <class T>
+void test_case_find_first_of(const vector<T>& input, const vector<T>& needle) {
+    auto expected = last_known_good_find_first_of(input.begin(), input.end(), needle.begin(), needle.end());
+    auto actual   = find_first_of(input.begin(), input.end(), needle.begin(), needle.end());
+    assert(expected == actual);
+#ifdef __cpp_lib_concepts
+    auto range = ranges::find_first_of(input, needle);
+    assert(expected == range);
+#endif // defined(__cpp_lib_concepts)
+}
+
+template <class T>
+void test_find_first_of(mt19937_64& gen) {
+    using TD = conditional_t<sizeof(T) == 1, int, T>;
+    uniform_int_distribution<TD> dis(0, 255);
+    uniform_int_distribution<size_t> needle_size_dis(0, 40);
+    vector<T> input;
+    vector<T> needle;
+    input.reserve(dataCount);
+    test_case_find_first_of(input, needle);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        needle.resize(needle_size_dis(gen));
+        for (auto& e : needle) {
+            e = static_cast<T>(dis(gen));
+        }
+        test_case_find_first_of(input, needle);
+    }
+}
+
+template <class C>
+void test_case_string_find_of(const basic_string<C>& input, const basic_string<C>& needle, const size_t start) {
+    constexpr size_t npos = basic_string<C>::npos;
+    const auto in_needle  = [&](const C c) {
+        return last_known_good_find_first_of(needle.begin(), needle.end(), &c, &c + 1) != needle.end();
+    };
+
+    size_t expected_first_of     = npos;
+    size_t expected_first_not_of = npos;
+    for (size_t pos = input.size(); pos-- > start;) {
+        (in_needle(input[pos]) ? expected_first_of : expected_first_not_of) = pos;
+    }
+
+    size_t expected_last_of     = npos;
+    size_t expected_last_not_of = npos;
+    if (!input.empty()) {
+        for (size_t pos = 0; pos <= (min) (start, input.size() - 1); ++pos) {
+            (in_needle(input[pos]) ? expected_last_of : expected_last_not_of) = pos;
+        }
+    }
+
+    assert(input.find_first_of(needle, start) == expected_first_of);
+    assert(input.find_last_of(needle, start) == expected_last_of);
+    assert(input.find_first_not_of(needle, start) == expected_first_not_of);
+    assert(input.find_last_not_of(needle, start) == expected_last_not_of);
+}
+
+template <class C>
+void test_string_find_of(mt19937_64& gen) {
+    uniform_int_distribution<int> dis(0, sizeof(C) == 1 ? 255 : 511);
+    uniform_int_distribution<size_t> needle_size_dis(0, 20);
+    basic_string<C> input;
+    basic_string<C> needle;
+    test_case_string_find_of(input, needle, 0);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<C>(dis(gen)));
+        needle.resize(needle_size_dis(gen));
+        for (auto& e : needle) {
+            e = static_cast<C>(dis(gen));
+        }
+        test_case_string_find_of(input, needle, 0);
+        test_case_string_find_of(input, needle, input.size() / 2);
+        test_case_string_find_of(input, needle, basic_string<C>::npos);
+    }
+}
+
+template <class FwdIt1, class FwdIt2>
+pair<FwdIt1, FwdIt2> last_known_good_mismatch(FwdIt1 first1, FwdIt1 last1, FwdIt2 first2, FwdIt2 last2) {
+    for (; first1 != last1 && first2 != last2; ++first1, (void) ++first2) {
+        if (*first1 != *first2) {
+            break;
+        }
+    }
+
+    return {first1, first2};
+}
+
+template <class T>
+void test_case_mismatch_and_lex_compare(const vector<T>& a, const vector<T>& b) {
+    const auto expected = last_known_good_mismatch(a.begin(), a.end(), b.begin(), b.end());
+    assert(mismatch(a.begin(), a.end(), b.begin(), b.end()) == expected);
+    if (a.size() <= b.size()) {
+        assert(mismatch(a.begin(), a.end(), b.begin()) == expected);
+    }
+
+    bool expected_less;
+    bool expected_greater;
+    if (expected.second == b.end()) {
+        expected_less    = false;
+        expected_greater = false;
+    } else if (expected.first == a.end()) {
+        expected_less    = true;
+        expected_greater = true;
+    } else {
+        expected_less    = *expected.first < *expected.second;
+        expected_greater = *expected.first > *expected.second;
+    }
+
+    assert(lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()) == expected_less);
+    assert(lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), greater<>{}) == expected_greater);
+
+#ifdef __cpp_lib_concepts
+    const auto range = ranges::mismatch(a, b);
+    assert(range.in1 == expected.first);
+    assert(range.in2 == expected.second);
+
+    assert(ranges::lexicographical_compare(a, b) == expected_less);
+
+    strong_ordering expected_order = a.size() <=> b.size();
+    if (expected.first != a.end() && expected.second != b.end()) {
+        expected_order = *expected.first <=> *expected.second;
+    }
+
+    assert(lexicographical_compare_three_way(a.begin(), a.end(), b.begin(), b.end()) == expected_order);
+#endif // defined(__cpp_lib_concepts)
+}
+
+template <class T>
+void test_mismatch_and_lex_compare(mt19937_64& gen) {
+    using TD = conditional_t<sizeof(T) == 1, int, T>;
+    uniform_int_distribution<TD> dis(numeric_limits<T>::min(), numeric_limits<T>::max());
+    uniform_int_distribution<size_t> mode_dis(0, 3);
+    vector<T> a;
+    vector<T> b;
+    a.reserve(dataCount);
+    b.reserve(dataCount);
+    test_case_mismatch_and_lex_compare(a, b);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        a.push_back(static_cast<T>(dis(gen)));
+        b = a;
+
+        // most of the time, make the ranges differ in one element or in length, so that the mismatch is far away
+        const size_t mode = mode_dis(gen);
+        if (mode == 1) {
+            b.pop_back();
+        } else if (mode != 0) {
+            auto& e = b[uniform_int_distribution<size_t>(0, b.size() - 1)(gen)];
+            e       = static_cast<T>(e + 1);
+        }
+
+        test_case_mismatch_and_lex_compare(a, b);
+        test_case_mismatch_and_lex_compare(b, a);
+    }
+}
+
 template <class T>
 void test_min_max_element(mt19937_64& gen) {
     using Limits = numeric_limits<T>;
@@ -190,6 +448,67 @@ void test_min_max_element_pointers(mt19937_64& gen) {
     }
 }
 
+template <class T>
+void test_min_max_element_floating(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+
+    // -0.0 and +0.0 come first, so that the narrower pools are full of equivalent elements
+    const T values[] = {static_cast<T>(-0.0), static_cast<T>(0.0), static_cast<T>(-1.5), static_cast<T>(1.5),
+        -Limits::denorm_min(), Limits::denorm_min(), -Limits::infinity(), Limits::infinity(), Limits::lowest(),
+        Limits::max()};
+
+    for (const size_t pool_size : {size_t{2}, size_t{4}, size(values)}) {
+        uniform_int_distribution<size_t> dis(0, pool_size - 1);
+
+        vector<T> input;
+        input.reserve(dataCount);
+        test_case_min_max_element(input);
+        for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+            input.push_back(values[dis(gen)]);
+            test_case_min_max_element(input);
+        }
+    }
+}
+
+template <class T>
+void test_min_max_floating_values() {
+    // -0.0 and +0.0 are equivalent: min and max return the first of them, minmax returns the first and the last
+    const T neg_zero = static_cast<T>(-0.0);
+    const T pos_zero = static_cast<T>(0.0);
+
+    assert(signbit(min({neg_zero, pos_zero, neg_zero, pos_zero, neg_zero, pos_zero, neg_zero, pos_zero})));
+    assert(signbit(max({neg_zero, pos_zero, neg_zero, pos_zero, neg_zero, pos_zero, neg_zero, pos_zero})));
+    assert(signbit(minmax({neg_zero, pos_zero, neg_zero, pos_zero, neg_zero, pos_zero, neg_zero, pos_zero}).first));
+    assert(!signbit(minmax({neg_zero, pos_zero, neg_zero, pos_zero, neg_zero, pos_zero, neg_zero, pos_zero}).second));
+
+    vector<T> input(40);
+    for (size_t i = 0; i != input.size(); ++i) {
+        input[i] = i % 2 == 0 ? neg_zero : pos_zero;
+    }
+
+    assert(signbit(*min_element(input.begin(), input.end())));
+    assert(signbit(*max_element(input.begin(), input.end())));
+    assert(signbit(*minmax_element(input.begin(), input.end()).first));
+    assert(!signbit(*minmax_element(input.begin(), input.end()).second));
+
+#ifdef __cpp_lib_concepts
+    assert(signbit(ranges::min(input)));
+    assert(signbit(ranges::max(input)));
+    assert(signbit(ranges::minmax(input).min));
+    assert(!signbit(ranges::minmax(input).max));
+#endif // __cpp_lib_concepts
+
+    input[17] = static_cast<T>(-2.0);
+    input[23] = static_cast<T>(-2.0);
+    input[29] = static_cast<T>(3.0);
+    input[31] = static_cast<T>(3.0);
+
+    assert(min_element(input.begin(), input.end()) == input.begin() + 17);
+    assert(max_element(input.begin(), input.end()) == input.begin() + 29);
+    assert(minmax_element(input.begin(), input.end()).first == input.begin() + 17);
+    assert(minmax_element(input.begin(), input.end()).second == input.begin() + 31);
+}
+
 template <class ElementType, size_t VectorSize>
 void test_min_max_element_special_cases() {
     constexpr size_t block_size_in_vectors  = 1 << (sizeof(ElementType) * CHAR_BIT);
@@ -322,6 +641,322 @@ void test_swap_ranges(mt19937_64& gen) {
     }
 }
 
+template <class FwdIt, class T>
+FwdIt last_known_good_remove(FwdIt first, FwdIt last, T v) {
+    FwdIt dest = first;
+    for (; first != last; ++first) {
+        if (*first != v) {
+            *dest = *first;
+            ++dest;
+        }
+    }
+
+    return dest;
+}
+
+template <class FwdIt>
+FwdIt last_known_good_unique(FwdIt first, FwdIt last) {
+    if (first == last) {
+        return last;
+    }
+
+    FwdIt dest = first;
+    while (++first != last) {
+        if (*dest != *first) {
+            ++dest;
+            *dest = *first;
+        }
+    }
+
+    return ++dest;
+}
+
+template <class T>
+void test_case_remove_and_unique(const vector<T>& input, const T v) {
+    vector<T> expected = input;
+    expected.erase(last_known_good_remove(expected.begin(), expected.end(), v), expected.end());
+
+    vector<T> actual = input;
+    actual.erase(remove(actual.begin(), actual.end(), v), actual.end());
+    assert(expected == actual);
+
+    vector<T> copied(input.size());
+    copied.erase(remove_copy(input.begin(), input.end(), copied.begin(), v), copied.end());
+    assert(expected == copied);
+
+#if _HAS_CXX20
+    actual = input;
+    assert(erase(actual, v) == input.size() - expected.size());
+    assert(expected == actual);
+#endif // _HAS_CXX20
+
+#ifdef __cpp_lib_concepts
+    actual = input;
+    actual.erase(ranges::remove(actual, v).begin(), actual.end());
+    assert(expected == actual);
+
+    copied.assign(input.size(), T{});
+    copied.erase(ranges::remove_copy(input, copied.begin(), v).out, copied.end());
+    assert(expected == copied);
+#endif // __cpp_lib_concepts
+
+    expected = input;
+    expected.erase(last_known_good_unique(expected.begin(), expected.end()), expected.end());
+
+    actual = input;
+    actual.erase(unique(actual.begin(), actual.end()), actual.end());
+    assert(expected == actual);
+
+    copied.assign(input.size(), T{});
+    copied.erase(unique_copy(input.begin(), input.end(), copied.begin()), copied.end());
+    assert(expected == copied);
+
+#ifdef __cpp_lib_concepts
+    actual = input;
+    actual.erase(ranges::unique(actual).begin(), actual.end());
+    assert(expected == actual);
+
+    copied.assign(input.size(), T{});
+    copied.erase(ranges::unique_copy(input, copied.begin()).out, copied.end());
+    assert(expected == copied);
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_remove_and_unique(mt19937_64& gen) {
+    // Few distinct values, so that there are many elements to remove and many runs of equal elements
+    uniform_int_distribution<int> dis(0, 3);
+
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_remove_and_unique(input, T{0});
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        test_case_remove_and_unique(input, static_cast<T>(dis(gen)));
+    }
+}
+
+template <class FwdIt, class T>
+void last_known_good_replace(FwdIt first, FwdIt last, const T old_val, const T new_val) {
+    for (; first != last; ++first) {
+        if (*first == old_val) {
+            *first = new_val;
+        }
+    }
+}
+
+template <class T>
+void test_case_replace(const vector<T>& input, const T old_val, const T new_val) {
+    vector<T> expected = input;
+    last_known_good_replace(expected.begin(), expected.end(), old_val, new_val);
+
+    vector<T> actual = input;
+    replace(actual.begin(), actual.end(), old_val, new_val);
+    assert(expected == actual);
+
+    vector<T> copied(input.size());
+    assert(replace_copy(input.begin(), input.end(), copied.begin(), old_val, new_val) == copied.end());
+    assert(expected == copied);
+
+#ifdef __cpp_lib_concepts
+    actual = input;
+    assert(ranges::replace(actual, old_val, new_val) == actual.end());
+    assert(expected == actual);
+
+    copied.assign(input.size(), T{});
+    assert(ranges::replace_copy(input, copied.begin(), old_val, new_val).out == copied.end());
+    assert(expected == copied);
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_replace(mt19937_64& gen) {
+    // Few distinct values, so that there are many elements to replace
+    uniform_int_distribution<int> dis(0, 3);
+
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_replace(input, T{0}, T{1});
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        test_case_replace(input, static_cast<T>(dis(gen)), static_cast<T>(dis(gen) - 1));
+    }
+}
+
+template <class T>
+void test_case_fill(const size_t count, const T val) {
+    const T other = static_cast<T>(val + 1);
+
+    vector<T> expected;
+    for (size_t i = 0; i != count; ++i) {
+        expected.push_back(val);
+    }
+
+    vector<T> actual(count, val);
+    assert(expected == actual);
+
+    actual.assign(count, other);
+    actual.assign(count, val);
+    assert(expected == actual);
+
+    // The extra element checks that nothing is written past the end
+    actual.assign(count + 1, other);
+    fill(actual.begin(), actual.begin() + static_cast<ptrdiff_t>(count), val);
+    assert(equal(expected.begin(), expected.end(), actual.begin()) && actual.back() == other);
+
+    actual.assign(count + 1, other);
+    assert(fill_n(actual.begin(), count, val) == actual.end() - 1);
+    assert(equal(expected.begin(), expected.end(), actual.begin()) && actual.back() == other);
+
+    actual.assign(count + 1, other);
+    uninitialized_fill(actual.begin(), actual.end() - 1, val);
+    assert(equal(expected.begin(), expected.end(), actual.begin()) && actual.back() == other);
+
+    actual.assign(count + 1, other);
+    assert(uninitialized_fill_n(actual.begin(), count, val) == actual.end() - 1);
+    assert(equal(expected.begin(), expected.end(), actual.begin()) && actual.back() == other);
+
+#ifdef __cpp_lib_concepts
+    actual.assign(count + 1, other);
+    assert(ranges::fill(actual.begin(), actual.end() - 1, val) == actual.end() - 1);
+    assert(equal(expected.begin(), expected.end(), actual.begin()) && actual.back() == other);
+
+    actual.assign(count + 1, other);
+    assert(ranges::fill_n(actual.begin(), static_cast<ptrdiff_t>(count), val) == actual.end() - 1);
+    assert(equal(expected.begin(), expected.end(), actual.begin()) && actual.back() == other);
+
+    actual.assign(count + 1, other);
+    assert(ranges::uninitialized_fill(actual.begin(), actual.end() - 1, val) == actual.end() - 1);
+    assert(equal(expected.begin(), expected.end(), actual.begin()) && actual.back() == other);
+
+    actual.assign(count + 1, other);
+    assert(ranges::uninitialized_fill_n(actual.begin(), static_cast<ptrdiff_t>(count), val) == actual.end() - 1);
+    assert(equal(expected.begin(), expected.end(), actual.begin()) && actual.back() == other);
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_fill(mt19937_64& gen) {
+    uniform_int_distribution<int> dis(-100, 100);
+
+    for (size_t count = 0; count != 100; ++count) {
+        test_case_fill(count, static_cast<T>(dis(gen)));
+    }
+
+    // Just past the size where the vectorized fill switches to streaming stores
+    test_case_fill((size_t{4} << 20) / sizeof(T) + 3, static_cast<T>(dis(gen)));
+}
+
+template <size_t N, class Elem>
+void test_case_bitset(const bitset<N>& bits, const Elem elem0, const Elem elem1) {
+    using Str = basic_string<Elem>;
+
+    Str expected;
+    size_t expected_count = 0;
+    for (size_t i = N; i != 0; --i) {
+        expected.push_back(bits[i - 1] ? elem1 : elem0);
+        expected_count += bits[i - 1];
+    }
+
+    assert(bits.template to_string<Elem>(elem0, elem1) == expected);
+    assert(bitset<N>(expected, 0, Str::npos, elem0, elem1) == bits);
+    assert(bitset<N>(expected.c_str(), expected.size(), elem0, elem1) == bits);
+
+    // Characters past the first N are validated, but otherwise ignored
+    assert(bitset<N>(expected + elem1 + elem0, 0, Str::npos, elem0, elem1) == bits);
+
+    // A shorter string gives the low bits
+    const size_t half = N / 2;
+    assert(bitset<N>(expected, half, Str::npos, elem0, elem1) == ((bits << half) >> half));
+
+    if constexpr (N != 0) {
+        for (const size_t pos : {size_t{0}, N / 3, N - 1}) {
+            Str invalid = expected;
+            invalid[pos] = static_cast<Elem>('?');
+            try {
+                (void) bitset<N>(invalid, 0, Str::npos, elem0, elem1);
+                assert(false);
+            } catch (const invalid_argument&) {
+            }
+        }
+    }
+
+    assert(bits.count() == expected_count);
+    assert(bits.any() == (expected_count != 0));
+    assert(bits.none() == (expected_count == 0));
+    assert(bits.all() == (expected_count == N));
+}
+
+template <size_t N>
+void test_bitset(mt19937_64& gen) {
+    bitset<N> bits;
+    test_case_bitset(bits, '0', '1');
+    test_case_bitset(bits, L'0', L'1');
+
+    bits.set();
+    test_case_bitset(bits, '0', '1');
+    test_case_bitset(bits, L'0', L'1');
+
+    for (int attempts = 0; attempts < 8; ++attempts) {
+        for (size_t i = 0; i != N; ++i) {
+            bits[i] = (gen() & 1) != 0;
+        }
+
+        test_case_bitset(bits, '0', '1');
+        test_case_bitset(bits, 'x', 'y');
+        test_case_bitset(bits, L'0', L'1');
+        test_case_bitset(bits, static_cast<wchar_t>(0xD800), static_cast<wchar_t>(0xFFFF));
+    }
+}
+
+void test_bitset_count_lanes() {
+    // The vectorized count() accumulates each 64-bit lane separately; give every lane a different popcount
+    // so that the final sum across lanes is checked, and make the total large enough to need many iterations
+    constexpr size_t N = size_t{1} << 20;
+    const auto bits    = make_unique<bitset<N>>();
+    for (size_t word = 0; word != N / 64; ++word) {
+        const size_t lane_bits = (word % 4) * 16 + 1;
+        for (size_t i = 0; i != lane_bits; ++i) {
+            bits->set(word * 64 + i);
+        }
+    }
+
+    assert(bits->count() == (N / 256) * (1 + 17 + 33 + 49));
+
+    bits->set();
+    assert(bits->count() == N);
+    assert(bits->all());
+
+    bits->reset(N - 1);
+    assert(bits->count() == N - 1);
+    assert(!bits->all());
+}
+
+template <size_t N>
+void test_bitset_reductions() {
+    // any() and all() stop at the first block that decides them; move the deciding bit through every block and tail
+    for (const size_t pos : {size_t{0}, size_t{31}, size_t{255}, size_t{256}, size_t{511}, size_t{512}, size_t{600},
+             size_t{1000}, N / 2, N - 33, N - 32, N - 1}) {
+        if (pos >= N) {
+            continue;
+        }
+
+        bitset<N> bits;
+        bits.set(pos);
+        assert(bits.any());
+        assert(!bits.none());
+        assert(!bits.all());
+
+        bits.flip();
+        assert(bits.any());
+        assert(!bits.none());
+        assert(!bits.all());
+
+        bits.set(pos);
+        assert(bits.all());
+    }
+}
+
 void test_vector_algorithms(mt19937_64& gen) {
     test_count<char>(gen);
     test_count<signed char>(gen);
@@ -343,6 +978,75 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_find<long long>(gen);
     test_find<unsigned long long>(gen);
 
+    test_search<char>(gen);
+    test_search<signed char>(gen);
+    test_search<unsigned char>(gen);
+    test_search<short>(gen);
+    test_search<unsigned short>(gen);
+    test_search<int>(gen);
+    test_search<unsigned int>(gen);
+    test_search<long long>(gen);
+    test_search<unsigned long long>(gen);
+
+    test_string_find<char>(gen);
+    test_string_find<wchar_t>(gen);
+    test_string_find<char16_t>(gen);
+    test_string_find<char32_t>(gen);
+
+    test_find_first_of<char>(gen);
+    test_find_first_of<signed char>(gen);
+    test_find_first_of<unsigned char>(gen);
+    test_find_first_of<short>(gen);
+    test_find_first_of<unsigned short>(gen);
+    test_find_first_of<int>(gen);
+    test_find_first_of<unsigned int>(gen);
+    test_find_first_of<long long>(gen);
+    test_find_first_of<unsigned long long>(gen);
+
+    test_string_find_of<char>(gen);
+    test_string_find_of<wchar_t>(gen);
+    test_string_find_of<char16_t>(gen);
+    test_string_find_of<char32_t>(gen);
+
+    test_mismatch_and_lex_compare<char>(gen);
+    test_mismatch_and_lex_compare<signed char>(gen);
+    test_mismatch_and_lex_compare<unsigned char>(gen);
+    test_mismatch_and_lex_compare<short>(gen);
+    test_mismatch_and_lex_compare<unsigned short>(gen);
+    test_mismatch_and_lex_compare<int>(gen);
+    test_mismatch_and_lex_compare<unsigned int>(gen);
+    test_mismatch_and_lex_compare<long long>(gen);
+    test_mismatch_and_lex_compare<unsigned long long>(gen);
+
+    test_remove_and_unique<char>(gen);
+    test_remove_and_unique<signed char>(gen);
+    test_remove_and_unique<unsigned char>(gen);
+    test_remove_and_unique<short>(gen);
+    test_remove_and_unique<unsigned short>(gen);
+    test_remove_and_unique<int>(gen);
+    test_remove_and_unique<unsigned int>(gen);
+    test_remove_and_unique<long long>(gen);
+    test_remove_and_unique<unsigned long long>(gen);
+
+    test_replace<char>(gen);
+    test_replace<signed char>(gen);
+    test_replace<unsigned char>(gen);
+    test_replace<short>(gen);
+    test_replace<unsigned short>(gen);
+    test_replace<int>(gen);
+    test_replace<unsigned int>(gen);
+    test_replace<long long>(gen);
+    test_replace<unsigned long long>(gen);
+
+    test_fill<short>(gen);
+    test_fill<unsigned short>(gen);
+    test_fill<int>(gen);
+    test_fill<unsigned int>(gen);
+    test_fill<long long>(gen);
+    test_fill<unsigned long long>(gen);
+    test_fill<float>(gen);
+    test_fill<double>(gen);
+
 #if _HAS_CXX23 && defined(__cpp_lib_concepts)
     test_find_last<char>(gen);
     test_find_last<signed char>(gen);
@@ -365,6 +1069,13 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_min_max_element<long long>(gen);
     test_min_max_element<unsigned long long>(gen);
 
+    test_min_max_element_floating<float>(gen);
+    test_min_max_element_floating<double>(gen);
+    test_min_max_element_floating<long double>(gen);
+
+    test_min_max_floating_values<float>();
+    test_min_max_floating_values<double>();
+
     test_min_max_element_pointers(gen);
 
     test_min_max_element_special_cases<int8_t, 16>(); // SSE2 vectors
@@ -409,6 +1120,27 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_swap_ranges<int>(gen);
     test_swap_ranges<unsigned int>(gen);
     test_swap_ranges<unsigned long long>(gen);
+
+    test_bitset<0>(gen);
+    test_bitset<1>(gen);
+    test_bitset<15>(gen);
+    test_bitset<16>(gen);
+    test_bitset<31>(gen);
+    test_bitset<32>(gen);
+    test_bitset<33>(gen);
+    test_bitset<64>(gen);
+    test_bitset<65>(gen);
+    test_bitset<100>(gen);
+    test_bitset<512>(gen);
+    test_bitset<513>(gen);
+    test_bitset<1000>(gen);
+    test_bitset<4096>(gen);
+    test_bitset_count_lanes();
+    test_bitset_reductions<512>();
+    test_bitset_reductions<513>();
+    test_bitset_reductions<1000>();
+    test_bitset_reductions<1088>();
+    test_bitset_reductions<4096>();
 }
 
 template <typename Container1, typename Container2>
@@ -355,6 +355,18 @@ STATIC_ASSERT(__cpp_lib_filesystem == 201703L);
 #error __cpp_lib_filesystem is defined
 #endif
 
+#if _HAS_CXX23 && defined(__cpp_lib_concepts) // TRANSITION, GH-395
+STATIC_ASSERT(__cpp_lib_flat_map == 202207L);
+#elif defined(__cpp_lib_flat_map)
+#error __cpp_lib_flat_map is defined
+#endif
+
+#if _HAS_CXX23 && defined(__cpp_lib_concepts) // TRANSITION, GH-395
+STATIC_ASSERT(__cpp_lib_flat_set == 202207L);
+#elif defined(__cpp_lib_flat_set)
+#error __cpp_lib_flat_set is defined
+#endif
+
 #ifdef __cpp_lib_concepts
 STATIC_ASSERT(__cpp_lib_format == 202304L);
 #elif defined(__cpp_lib_format)